@@ -0,0 +1,241 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Bench {
+    // Keeps the compiler from discarding a computed value
+    template <typename T>
+    inline void doNotOptimize(const T& value) {
+#if defined(_MSC_VER)
+        static volatile const void* sink;
+        sink = &value;
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+    // Operation runs the measured code `iterations` times. Setup builds the operation and
+    // its data; it only runs for benchmarks that pass the filter.
+    using Operation = std::function<void(std::uint64_t iterations)>;
+    using Setup = std::function<Operation()>;
+
+    struct Benchmark {
+        std::string name;
+        std::uint64_t itemsPerOp; // Elements processed by one iteration, for ns/item
+        Setup setup;
+        bool needsWindow;
+    };
+
+    // A quantity a benchmark counts while it runs (draw calls, vertices, ...), reported
+    // per iteration next to the time
+    struct Counter {
+        std::string name;
+        double perIteration;
+    };
+
+    // Totals added by the running operation through addCounter(). The suite clears them
+    // before each sample and divides the last sample's totals by its iteration count.
+    inline std::vector<Counter>& counterTotals() {
+        static std::vector<Counter> totals;
+        return totals;
+    }
+
+    // Call from inside an Operation, with the amount for all of its iterations
+    inline void addCounter(const std::string& name, double amount) {
+        for (Counter& counter : counterTotals()) {
+            if (counter.name == name) {
+                counter.perIteration += amount;
+                return;
+            }
+        }
+        counterTotals().push_back({name, amount});
+    }
+
+    struct Result {
+        std::string name;
+        std::uint64_t itemsPerOp;
+        std::uint64_t iterations; // Per sample
+        int samples;
+        double minNs;             // Per iteration
+        double medianNs;
+        double meanNs;
+        std::vector<Counter> counters; // Empty unless the benchmark reports any
+    };
+
+    struct Options {
+        std::string filter;            // Substring of the benchmark name, empty runs all
+        bool graphics = true;          // false skips benchmarks that need a window
+        double sampleMilliseconds = 20.0;
+        int samples = 10;
+    };
+
+    class Suite {
+    private:
+        std::vector<Benchmark> benchmarks;
+
+    public:
+        void add(const std::string& name, std::uint64_t itemsPerOp, Setup setup, bool needsWindow = false) {
+            benchmarks.push_back({name, itemsPerOp, std::move(setup), needsWindow});
+        }
+
+        static void writeHeader(std::ostream& out) {
+            char line[160];
+            std::snprintf(line, sizeof(line), "%-40s %14s %14s %12s\n", "benchmark", "min_ns", "median_ns", "ns_per_item");
+            out << line;
+        }
+
+        const std::vector<Benchmark>& getBenchmarks() const {
+            return benchmarks;
+        }
+
+        bool isSelected(const Benchmark& benchmark, const Options& options) const {
+            if (benchmark.needsWindow && !options.graphics) {
+                return false;
+            }
+            return options.filter.empty() || benchmark.name.find(options.filter) != std::string::npos;
+        }
+
+        // Each sample runs long enough to reach sampleMilliseconds; the iteration count is
+        // calibrated once per benchmark and kept for all of its samples
+        std::vector<Result> run(const Options& options, std::ostream* progress = nullptr) const {
+            std::vector<Result> results;
+
+            for (const Benchmark& benchmark : benchmarks) {
+                if (!isSelected(benchmark, options)) {
+                    continue;
+                }
+
+                Operation operation = benchmark.setup();
+                std::uint64_t iterations = calibrate(operation, options.sampleMilliseconds);
+
+                std::vector<double> perIteration;
+                for (int sample = 0; sample < options.samples; sample++) {
+                    perIteration.push_back(measure(operation, iterations) / iterations);
+                }
+                std::vector<Counter> counters = counterTotals();
+                for (Counter& counter : counters) {
+                    counter.perIteration /= iterations;
+                }
+                std::sort(perIteration.begin(), perIteration.end());
+
+                double total = 0.0;
+                for (double value : perIteration) {
+                    total += value;
+                }
+
+                Result result;
+                result.name = benchmark.name;
+                result.itemsPerOp = benchmark.itemsPerOp;
+                result.iterations = iterations;
+                result.samples = options.samples;
+                result.minNs = perIteration.front();
+                result.medianNs = perIteration[perIteration.size() / 2];
+                result.meanNs = total / perIteration.size();
+                result.counters = counters;
+                results.push_back(result);
+
+                if (progress) {
+                    writeLine(*progress, result);
+                }
+            }
+
+            return results;
+        }
+
+    private:
+        // Nanoseconds for one call of operation(iterations)
+        static double measure(const Operation& operation, std::uint64_t iterations) {
+            counterTotals().clear();
+            auto start = std::chrono::steady_clock::now();
+            operation(iterations);
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        static std::uint64_t calibrate(const Operation& operation, double sampleMilliseconds) {
+            double target = sampleMilliseconds * 1e6;
+            std::uint64_t iterations = 1;
+
+            // Also serves as the warm-up
+            while (true) {
+                double elapsed = measure(operation, iterations);
+                if (elapsed >= target / 10.0 || iterations >= (1ull << 40)) {
+                    double perIteration = std::max(elapsed / iterations, 1e-3);
+                    return std::max<std::uint64_t>(1, static_cast<std::uint64_t>(target / perIteration));
+                }
+                iterations *= 2;
+            }
+        }
+
+        static void writeLine(std::ostream& out, const Result& result) {
+            char line[160];
+            std::snprintf(line, sizeof(line), "%-40s %14.1f %14.1f %12.3f\n", result.name.c_str(), result.minNs,
+                          result.medianNs, result.medianNs / result.itemsPerOp);
+            out << line;
+            for (const Counter& counter : result.counters) {
+                std::snprintf(line, sizeof(line), "%-40s %14.1f %s/iteration\n", "", counter.perIteration,
+                              counter.name.c_str());
+                out << line;
+            }
+        }
+    };
+
+    inline std::string escapeJson(const std::string& text) {
+        std::string escaped;
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                escaped += '\\';
+            }
+            escaped += c;
+        }
+        return escaped;
+    }
+
+    // One object per run: free-form context (revision label, SIMD level, ...) plus one
+    // entry per benchmark. Times are nanoseconds per iteration, and so are counters.
+    inline void writeJson(std::ostream& out, const std::vector<std::pair<std::string, std::string>>& context,
+                          const std::vector<Result>& results) {
+        std::streamsize precision = out.precision(12);
+        out << "{\n  \"context\": {";
+        for (std::size_t i = 0; i < context.size(); i++) {
+            out << (i == 0 ? "\n" : ",\n") << "    \"" << escapeJson(context[i].first) << "\": \""
+                << escapeJson(context[i].second) << "\"";
+        }
+        out << "\n  },\n  \"benchmarks\": [";
+
+        for (std::size_t i = 0; i < results.size(); i++) {
+            const Result& result = results[i];
+            out << (i == 0 ? "\n" : ",\n")
+                << "    {\"name\": \"" << escapeJson(result.name) << "\""
+                << ", \"items_per_op\": " << result.itemsPerOp
+                << ", \"iterations\": " << result.iterations
+                << ", \"samples\": " << result.samples
+                << ", \"min_ns\": " << result.minNs
+                << ", \"median_ns\": " << result.medianNs
+                << ", \"mean_ns\": " << result.meanNs
+                << ", \"median_ns_per_item\": " << result.medianNs / result.itemsPerOp;
+            if (!result.counters.empty()) {
+                out << ", \"counters\": {";
+                for (std::size_t c = 0; c < result.counters.size(); c++) {
+                    out << (c == 0 ? "" : ", ") << "\"" << escapeJson(result.counters[c].name) << "\": "
+                        << result.counters[c].perIteration;
+                }
+                out << "}";
+            }
+            out << "}";
+        }
+        out << "\n  ]\n}\n";
+        out.precision(precision);
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "Benchmark.h"
+#include "../../Engine/Core/FrameArena.h"
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Bench {
+    // One frame's transient data the way a HUD or debug overlay produces it: a formatted
+    // label per entity and a scratch list of the entities on screen. The heap case builds
+    // them with std::string and std::vector, the arena case in a FrameArena reset every frame.
+    inline void registerCoreBenchmarks(Suite& suite) {
+        static const std::size_t LABELS = 64;
+        static const std::size_t VISIBLE = 1000;
+
+        suite.add("core/frame_scratch_heap", LABELS, []() -> Operation {
+            return [](std::uint64_t iterations) {
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    std::vector<std::string> labels;
+                    for (std::size_t i = 0; i < LABELS; i++) {
+                        char line[64];
+                        std::snprintf(line, sizeof(line), "BALL %zu  X %.1f  Y %.1f", i, i * 12.5f, i * 7.25f);
+                        labels.emplace_back(line);
+                    }
+                    std::vector<std::uint32_t> visible;
+                    for (std::uint32_t i = 0; i < VISIBLE; i++) {
+                        visible.push_back(i);
+                    }
+                    doNotOptimize(labels.back().data());
+                    doNotOptimize(visible.data());
+                }
+            };
+        });
+
+        suite.add("core/frame_scratch_arena", LABELS, []() -> Operation {
+            auto arena = std::make_shared<Engine::Core::FrameArena>();
+            return [arena](std::uint64_t iterations) {
+                using Engine::Core::ArenaAllocator;
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    arena->reset();
+                    std::string_view* labels = arena->allocateArray<std::string_view>(LABELS);
+                    for (std::size_t i = 0; i < LABELS; i++) {
+                        labels[i] = arena->format("BALL %zu  X %.1f  Y %.1f", i, i * 12.5f, i * 7.25f);
+                    }
+                    std::vector<std::uint32_t, ArenaAllocator<std::uint32_t>> visible{
+                        ArenaAllocator<std::uint32_t>(*arena)};
+                    for (std::uint32_t i = 0; i < VISIBLE; i++) {
+                        visible.push_back(i);
+                    }
+                    doNotOptimize(labels[LABELS - 1].data());
+                    doNotOptimize(visible.data());
+                }
+            };
+        });
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include "Benchmark.h"
+#include "../../Engine/ECS/Entity.h"
+#include "../../Engine/ECS/Systems.h"
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Bench {
+    // Stand-ins for game entities: two overrides so the call cannot be devirtualized
+    class SlowEntity : public Engine::ECS::Entity {
+    public:
+        void update(float deltaTime) override {
+            position += velocity * (deltaTime * 0.5f);
+        }
+    };
+
+    class FastEntity : public Engine::ECS::Entity {
+    public:
+        void update(float deltaTime) override {
+            position += velocity * (deltaTime * 2.0f);
+        }
+    };
+
+    // Object-per-entity virtual update against World + MovementSystem over the same data
+    inline void registerEcsBenchmarks(Suite& suite) {
+        const std::size_t counts[] = {100000, 1000000};
+        const char* countNames[] = {"100k", "1m"};
+
+        for (int c = 0; c < 2; c++) {
+            std::size_t count = counts[c];
+
+            suite.add(std::string("ecs/entity_virtual_update_") + countNames[c], count, [count]() -> Operation {
+                // Allocated one by one and shuffled, like entities created over a game's lifetime
+                auto entities = std::make_shared<std::vector<std::unique_ptr<Engine::ECS::Entity>>>();
+                for (std::size_t i = 0; i < count; i++) {
+                    std::unique_ptr<Engine::ECS::Entity> entity;
+                    if (i % 2 == 0) {
+                        entity = std::make_unique<SlowEntity>();
+                    } else {
+                        entity = std::make_unique<FastEntity>();
+                    }
+                    entity->setVelocity(1.0f + i % 7, 2.0f - i % 3);
+                    entities->push_back(std::move(entity));
+                }
+                std::shuffle(entities->begin(), entities->end(), std::mt19937(7));
+
+                return [entities](std::uint64_t iterations) {
+                    for (std::uint64_t n = 0; n < iterations; n++) {
+                        for (const std::unique_ptr<Engine::ECS::Entity>& entity : *entities) {
+                            entity->update(0.001f);
+                        }
+                    }
+                    doNotOptimize(entities->front()->getPosition());
+                };
+            });
+
+            suite.add(std::string("ecs/world_movement_") + countNames[c], count, [count]() -> Operation {
+                using namespace Engine::ECS;
+                auto world = std::make_shared<World>();
+                for (std::size_t i = 0; i < count; i++) {
+                    world->create(Position{0.0f, 0.0f}, Velocity{1.0f + i % 7, 2.0f - i % 3});
+                }
+
+                return [world](std::uint64_t iterations) {
+                    for (std::uint64_t n = 0; n < iterations; n++) {
+                        MovementSystem::update(*world, 0.001f);
+                    }
+                    doNotOptimize(world->getEntityCount());
+                };
+            });
+        }
+
+        suite.add("ecs/world_create_destroy_10k", 10000, []() -> Operation {
+            using namespace Engine::ECS;
+            auto world = std::make_shared<World>();
+            auto ids = std::make_shared<std::vector<EntityId>>();
+            ids->reserve(10000);
+
+            return [world, ids](std::uint64_t iterations) {
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    for (std::size_t i = 0; i < 10000; i++) {
+                        ids->push_back(world->create(Position{0.0f, 0.0f}, Velocity{1.0f, 1.0f}));
+                    }
+                    for (const EntityId& id : *ids) {
+                        world->destroy(id);
+                    }
+                    ids->clear();
+                }
+                doNotOptimize(world->getEntityCount());
+            };
+        });
+    }
+}
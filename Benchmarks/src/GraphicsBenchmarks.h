@@ -0,0 +1,276 @@
+#pragma once
+#include "Benchmark.h"
+#include "../../Engine/Graphics/Renderer.h"
+#include "../../Engine/Graphics/SimpleFont.h"
+#include "../../Engine/Graphics/TextCache.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Bench {
+    // A line of menu text as PongGame draws it (centered on x)
+    struct Label {
+        const char* text;
+        float centerX;
+        float y;
+        float pixelSize;
+        sf::Color color;
+    };
+
+    // sf::RectangleShape fills are triangle fans: center, four corners, first corner again
+    static const std::size_t RECTANGLE_SHAPE_VERTICES = 6;
+
+    // The text path before glyphs were batched: one sf::RectangleShape draw per lit font
+    // pixel. Kept as the baseline for the batched paths; returns the number of draws.
+    inline std::size_t drawTextPerPixel(sf::RenderTarget* target, std::string_view text,
+                                        float x, float y, float pixelSize, const sf::Color& color) {
+        std::size_t draws = 0;
+        float currentX = x;
+        for (char c : text) {
+            if (c != ' ') {
+                const bool* pattern = Engine::Graphics::SimpleFont::getCharPattern(c);
+                for (int row = 0; row < 7; row++) {
+                    for (int col = 0; col < 5; col++) {
+                        if (pattern[row * 5 + col]) {
+                            sf::RectangleShape pixel({pixelSize, pixelSize});
+                            pixel.setPosition({currentX + col * pixelSize, y + row * pixelSize});
+                            pixel.setFillColor(color);
+                            target->draw(pixel);
+                            draws++;
+                        }
+                    }
+                }
+            }
+            currentX += 6 * pixelSize;
+        }
+        return draws;
+    }
+
+    // Draw calls and vertices the renderer submitted in the frame it just presented
+    inline void addRendererCounters(const Engine::Graphics::Renderer& renderer) {
+        addCounter("draw_calls", renderer.getFrameStats().drawCalls);
+        addCounter("vertices", static_cast<double>(renderer.getFrameStats().vertices));
+    }
+
+    // Draw calls and vertices of the batched text paths: one vertex array per label
+    inline void countBatchedText(const std::vector<Label>& labels, double& drawCalls, double& vertices) {
+        sf::VertexArray mesh(sf::PrimitiveType::Triangles);
+        drawCalls = 0.0;
+        vertices = 0.0;
+        for (const Label& label : labels) {
+            mesh.clear();
+            Engine::Graphics::SimpleFont::appendText(mesh, label.text, 0.0f, 0.0f, label.pixelSize, label.color);
+            drawCalls += mesh.getVertexCount() > 0 ? 1.0 : 0.0;
+            vertices += static_cast<double>(mesh.getVertexCount());
+        }
+    }
+
+    // Text meshing and width on the CPU, then the draw paths that need a window. The
+    // window is created by getWindow on first use, so --no-graphics runs never open one.
+    inline void registerGraphicsBenchmarks(Suite& suite, std::function<sf::RenderWindow*()> getWindow) {
+        using namespace Engine::Graphics;
+        static const std::string TEXT = "PLAYER 1 WINS 10 - 7";
+
+        suite.add("text/simplefont_append_text", TEXT.size(), []() -> Operation {
+            auto vertices = std::make_shared<sf::VertexArray>(sf::PrimitiveType::Triangles);
+            return [vertices](std::uint64_t iterations) {
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    vertices->clear();
+                    SimpleFont::appendText(*vertices, TEXT, 10.0f, 10.0f, 4.0f, sf::Color::White);
+                }
+                doNotOptimize(vertices->getVertexCount());
+            };
+        });
+
+        suite.add("text/simplefont_text_width", TEXT.size(), []() -> Operation {
+            return [](std::uint64_t iterations) {
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    doNotOptimize(SimpleFont::getTextWidth(TEXT, 4.0f));
+                }
+            };
+        });
+
+        suite.add("text/textcache_text_width", TEXT.size(), []() -> Operation {
+            auto cache = std::make_shared<TextCache>();
+            return [cache](std::uint64_t iterations) {
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    doNotOptimize(cache->getTextWidth(TEXT, 4.0f, sf::Color::White));
+                }
+            };
+        });
+
+        // Draw paths: 100 draws per iteration, presented once per operation call
+        static const int DRAWS = 100;
+
+        suite.add("graphics/simplefont_draw_text_x100", DRAWS, [getWindow]() -> Operation {
+            sf::RenderWindow* window = getWindow();
+            return [window](std::uint64_t iterations) {
+                window->clear();
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    for (int i = 0; i < DRAWS; i++) {
+                        SimpleFont::drawText(window, TEXT, 10.0f, static_cast<float>(i * 5), 2.0f, sf::Color::White);
+                    }
+                }
+                window->display();
+            };
+        }, true);
+
+        suite.add("graphics/textcache_draw_text_x100", DRAWS, [getWindow]() -> Operation {
+            sf::RenderWindow* window = getWindow();
+            auto cache = std::make_shared<TextCache>();
+            return [window, cache](std::uint64_t iterations) {
+                window->clear();
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    for (int i = 0; i < DRAWS; i++) {
+                        cache->drawText(window, TEXT, 10.0f, static_cast<float>(i * 5), 2.0f, sf::Color::White);
+                    }
+                }
+                window->display();
+            };
+        }, true);
+
+        // Menu text through the per-pixel baseline, SimpleFont's batched run and the
+        // retained TextCache mesh; each iteration draws the labels once and reports the
+        // draw calls and vertices it submitted
+        static const std::vector<std::pair<std::string, std::vector<Label>>> MENUS = {
+            {"play_with_friend", {
+                {"PLAY WITH FRIEND", 400.0f, 220.0f, 4.0f, sf::Color::Yellow}
+            }},
+            {"pause_menu", {
+                {"PAUSED", 400.0f, 100.0f, 6.0f, sf::Color::White},
+                {"RESUME", 400.0f, 220.0f, 4.0f, sf::Color::Yellow},
+                {"RESTART", 400.0f, 290.0f, 4.0f, sf::Color::White},
+                {"MAIN MENU", 400.0f, 360.0f, 4.0f, sf::Color::White},
+                {"EXIT", 400.0f, 430.0f, 4.0f, sf::Color::White},
+                {"USE UP/DOWN TO SELECT", 400.0f, 530.0f, 2.5f, sf::Color(150, 150, 150)}
+            }}
+        };
+
+        for (const auto& menu : MENUS) {
+            const std::vector<Label>& labels = menu.second;
+
+            suite.add("graphics/text_per_pixel/" + menu.first, labels.size(), [getWindow, labels]() -> Operation {
+                sf::RenderWindow* window = getWindow();
+                return [window, labels](std::uint64_t iterations) {
+                    std::size_t draws = 0;
+                    window->clear();
+                    for (std::uint64_t n = 0; n < iterations; n++) {
+                        for (const Label& label : labels) {
+                            float width = SimpleFont::getTextWidth(label.text, label.pixelSize);
+                            draws += drawTextPerPixel(window, label.text, label.centerX - width / 2.0f, label.y,
+                                                      label.pixelSize, label.color);
+                        }
+                    }
+                    window->display();
+                    addCounter("draw_calls", static_cast<double>(draws));
+                    addCounter("vertices", static_cast<double>(draws * RECTANGLE_SHAPE_VERTICES));
+                };
+            }, true);
+
+            suite.add("graphics/text_batched/" + menu.first, labels.size(), [getWindow, labels]() -> Operation {
+                sf::RenderWindow* window = getWindow();
+                double drawCalls;
+                double vertices;
+                countBatchedText(labels, drawCalls, vertices);
+                return [window, labels, drawCalls, vertices](std::uint64_t iterations) {
+                    window->clear();
+                    for (std::uint64_t n = 0; n < iterations; n++) {
+                        for (const Label& label : labels) {
+                            SimpleFont::drawTextCentered(window, label.text, label.centerX, label.y,
+                                                         label.pixelSize, label.color);
+                        }
+                    }
+                    window->display();
+                    addCounter("draw_calls", drawCalls * iterations);
+                    addCounter("vertices", vertices * iterations);
+                };
+            }, true);
+
+            suite.add("graphics/text_cached/" + menu.first, labels.size(), [getWindow, labels]() -> Operation {
+                sf::RenderWindow* window = getWindow();
+                auto cache = std::make_shared<TextCache>();
+                double drawCalls;
+                double vertices;
+                countBatchedText(labels, drawCalls, vertices);
+                return [window, cache, labels, drawCalls, vertices](std::uint64_t iterations) {
+                    window->clear();
+                    for (std::uint64_t n = 0; n < iterations; n++) {
+                        for (const Label& label : labels) {
+                            cache->drawTextCentered(window, label.text, label.centerX, label.y,
+                                                    label.pixelSize, label.color);
+                        }
+                    }
+                    window->display();
+                    addCounter("draw_calls", drawCalls * iterations);
+                    addCounter("vertices", vertices * iterations);
+                };
+            }, true);
+        }
+
+        // Renderer: record, sort and submit one frame worth of shapes per iteration. The
+        // operation presents once, so the frame stats cover all of its iterations.
+        static const int SHAPES = 1000;
+
+        suite.add("graphics/renderer_rectangles_1k", SHAPES, [getWindow]() -> Operation {
+            auto renderer = std::make_shared<Renderer>(getWindow());
+            sf::RenderWindow* window = getWindow();
+            return [renderer, window](std::uint64_t iterations) {
+                window->clear();
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    for (int i = 0; i < SHAPES; i++) {
+                        renderer->drawRectangle({static_cast<float>(i % 40) * 20.0f, static_cast<float>(i / 40) * 20.0f},
+                                                {15.0f, 15.0f}, sf::Color::White);
+                    }
+                    renderer->flush();
+                }
+                renderer->display();
+                addRendererCounters(*renderer);
+            };
+        }, true);
+
+        suite.add("graphics/renderer_circles_1k", SHAPES, [getWindow]() -> Operation {
+            auto renderer = std::make_shared<Renderer>(getWindow());
+            sf::RenderWindow* window = getWindow();
+            return [renderer, window](std::uint64_t iterations) {
+                window->clear();
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    for (int i = 0; i < SHAPES; i++) {
+                        renderer->drawCircle({static_cast<float>(i % 40) * 20.0f, static_cast<float>(i / 40) * 20.0f},
+                                             2.0f + i % 16, sf::Color::White);
+                    }
+                    renderer->flush();
+                }
+                renderer->display();
+                addRendererCounters(*renderer);
+            };
+        }, true);
+
+        // Interleaved layers and primitives: exercises the sort more than the submit
+        suite.add("graphics/renderer_mixed_layers_1k", SHAPES, [getWindow]() -> Operation {
+            auto renderer = std::make_shared<Renderer>(getWindow());
+            sf::RenderWindow* window = getWindow();
+            return [renderer, window](std::uint64_t iterations) {
+                window->clear();
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    for (int i = 0; i < SHAPES; i++) {
+                        renderer->setLayer(i % 4);
+                        sf::Vector2f position(static_cast<float>(i % 40) * 20.0f, static_cast<float>(i / 40) * 20.0f);
+                        if (i % 3 == 0) {
+                            renderer->drawLine(position, position + sf::Vector2f(10.0f, 10.0f), sf::Color::Red);
+                        } else if (i % 3 == 1) {
+                            renderer->drawCircle(position, 6.0f, sf::Color::Green);
+                        } else {
+                            renderer->drawRectangle(position, {12.0f, 12.0f}, sf::Color::Blue);
+                        }
+                    }
+                    renderer->flush();
+                }
+                renderer->setLayer(0);
+                renderer->display();
+                addRendererCounters(*renderer);
+            };
+        }, true);
+    }
+}
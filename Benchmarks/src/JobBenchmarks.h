@@ -0,0 +1,84 @@
+#pragma once
+#include "Benchmark.h"
+#include "../../Engine/Core/JobSystem.h"
+#include "../../Engine/Math/VectorBatch.h"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Bench {
+    // parallelFor scaling over 1M interleaved vectors, against the same loop on one thread
+    inline void registerJobBenchmarks(Suite& suite) {
+        static const std::size_t COUNT = 1000000;
+        static const std::size_t GRAIN = 16384;
+
+        struct Vectors {
+            std::vector<float> positions;
+            std::vector<float> velocities;
+
+            Vectors() : positions(COUNT * 2, 0.0f), velocities(COUNT * 2) {
+                for (std::size_t i = 0; i < velocities.size(); i++) {
+                    velocities[i] = 1.0f + i % 5;
+                }
+            }
+
+            void integrate(std::size_t begin, std::size_t end) {
+                Engine::Math::VectorBatch::integrateInterleaved(&positions[begin * 2], &velocities[begin * 2],
+                                                                end - begin, 0.001f);
+            }
+        };
+
+        suite.add("jobs/integrate_1m_serial", COUNT, []() -> Operation {
+            auto data = std::make_shared<Vectors>();
+            return [data](std::uint64_t iterations) {
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    data->integrate(0, COUNT);
+                }
+                doNotOptimize(data->positions.data());
+            };
+        });
+
+        // Thread counts include the calling thread: 2, 4, 8, ... up to the hardware
+        unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<unsigned int> threadCounts;
+        for (unsigned int threads = 2; threads < hardware; threads *= 2) {
+            threadCounts.push_back(threads);
+        }
+        if (hardware > 1) {
+            threadCounts.push_back(hardware);
+        }
+
+        for (unsigned int threads : threadCounts) {
+            suite.add("jobs/parallel_for_1m_t" + std::to_string(threads), COUNT, [threads]() -> Operation {
+                auto data = std::make_shared<Vectors>();
+                auto jobs = std::make_shared<Engine::Core::JobSystem>(threads - 1);
+                return [data, jobs](std::uint64_t iterations) {
+                    for (std::uint64_t n = 0; n < iterations; n++) {
+                        jobs->parallelFor(0, COUNT, GRAIN, [&data](std::size_t begin, std::size_t end) {
+                            data->integrate(begin, end);
+                        });
+                    }
+                    doNotOptimize(data->positions.data());
+                };
+            });
+        }
+
+        // Many tiny jobs: measures scheduling overhead rather than the work
+        suite.add("jobs/parallel_for_64k_grain64", 65536, []() -> Operation {
+            auto values = std::make_shared<std::vector<float>>(65536, 1.0f);
+            auto jobs = std::make_shared<Engine::Core::JobSystem>();
+            return [values, jobs](std::uint64_t iterations) {
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    jobs->parallelFor(0, values->size(), 64, [&values](std::size_t begin, std::size_t end) {
+                        for (std::size_t i = begin; i < end; i++) {
+                            (*values)[i] = (*values)[i] * 0.5f + 1.0f;
+                        }
+                    });
+                }
+                doNotOptimize(values->data());
+            };
+        });
+    }
+}
@@ -0,0 +1,146 @@
+#pragma once
+#include "Benchmark.h"
+#include "../../Engine/Math/Random.h"
+#include "../../Engine/Math/Vector2.h"
+#include "../../Engine/Math/VectorBatch.h"
+#include <memory>
+#include <vector>
+
+namespace Bench {
+    // Vector2 operators one vector at a time, the batched kernels at every SIMD level, and
+    // the random number generator
+    inline void registerMathBenchmarks(Suite& suite) {
+        using Engine::Math::Vector2;
+        using Engine::Math::VectorBatch;
+        using Engine::Math::SimdLevel;
+        static const std::size_t COUNT = 4096;
+
+        struct Vectors {
+            std::vector<Vector2> positions;
+            std::vector<Vector2> velocities;
+            std::vector<float> lengths;
+
+            Vectors() : positions(COUNT), velocities(COUNT), lengths(COUNT) {
+                for (std::size_t i = 0; i < COUNT; i++) {
+                    positions[i] = Vector2(static_cast<float>(i), static_cast<float>(i % 97));
+                    velocities[i] = Vector2(3.0f + i % 7, -2.0f + i % 5);
+                }
+            }
+        };
+
+        suite.add("math/vector2_integrate_4k", COUNT, []() -> Operation {
+            auto data = std::make_shared<Vectors>();
+            return [data](std::uint64_t iterations) {
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    for (std::size_t i = 0; i < COUNT; i++) {
+                        data->positions[i] += data->velocities[i] * 0.001f;
+                    }
+                    doNotOptimize(data->positions.data());
+                }
+            };
+        });
+
+        suite.add("math/vector2_magnitude_4k", COUNT, []() -> Operation {
+            auto data = std::make_shared<Vectors>();
+            return [data](std::uint64_t iterations) {
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    for (std::size_t i = 0; i < COUNT; i++) {
+                        data->lengths[i] = data->velocities[i].magnitude();
+                    }
+                    doNotOptimize(data->lengths.data());
+                }
+            };
+        });
+
+        suite.add("math/vector2_normalize_4k", COUNT, []() -> Operation {
+            auto data = std::make_shared<Vectors>();
+            return [data](std::uint64_t iterations) {
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    for (std::size_t i = 0; i < COUNT; i++) {
+                        data->positions[i] = data->velocities[i].normalized();
+                    }
+                    doNotOptimize(data->positions.data());
+                }
+            };
+        });
+
+        const SimdLevel levels[] = {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2};
+        const char* levelNames[] = {"scalar", "sse2", "avx2"};
+        for (int level = 0; level < 3; level++) {
+            if (levels[level] > VectorBatch::detectSimdLevel()) {
+                continue;
+            }
+
+            SimdLevel simd = levels[level];
+            std::string suffix = std::string("_4k_") + levelNames[level];
+
+            suite.add("math/batch_integrate" + suffix, COUNT, [simd]() -> Operation {
+                auto data = std::make_shared<Vectors>();
+                return [data, simd](std::uint64_t iterations) {
+                    VectorBatch::setSimdLevel(simd);
+                    for (std::uint64_t n = 0; n < iterations; n++) {
+                        VectorBatch::integrateInterleaved(&data->positions[0].x, &data->velocities[0].x,
+                                                          COUNT, 0.001f);
+                        doNotOptimize(data->positions.data());
+                    }
+                    VectorBatch::setSimdLevel(VectorBatch::detectSimdLevel());
+                };
+            });
+
+            suite.add("math/batch_normalize" + suffix, COUNT, [simd]() -> Operation {
+                struct Columns {
+                    std::vector<float> xs;
+                    std::vector<float> ys;
+                };
+                auto data = std::make_shared<Columns>();
+                for (std::size_t i = 0; i < COUNT; i++) {
+                    data->xs.push_back(3.0f + i % 7);
+                    data->ys.push_back(-2.0f + i % 5);
+                }
+
+                return [data, simd](std::uint64_t iterations) {
+                    VectorBatch::setSimdLevel(simd);
+                    for (std::uint64_t n = 0; n < iterations; n++) {
+                        // Normalizing is idempotent, so running it again on its own output is fine
+                        VectorBatch::normalize(data->xs.data(), data->ys.data(), COUNT);
+                        doNotOptimize(data->xs.data());
+                    }
+                    VectorBatch::setSimdLevel(VectorBatch::detectSimdLevel());
+                };
+            });
+        }
+
+        suite.add("math/random_next", 1, []() -> Operation {
+            auto random = std::make_shared<Engine::Math::Random>(1);
+            return [random](std::uint64_t iterations) {
+                std::uint32_t sum = 0;
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    sum += random->next();
+                }
+                doNotOptimize(sum);
+            };
+        });
+
+        suite.add("math/random_range_int", 1, []() -> Operation {
+            auto random = std::make_shared<Engine::Math::Random>(1);
+            return [random](std::uint64_t iterations) {
+                int sum = 0;
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    sum += random->range(-30, 29);
+                }
+                doNotOptimize(sum);
+            };
+        });
+
+        suite.add("math/random_range_float", 1, []() -> Operation {
+            auto random = std::make_shared<Engine::Math::Random>(1);
+            return [random](std::uint64_t iterations) {
+                float sum = 0.0f;
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    sum += random->range(-1.0f, 1.0f);
+                }
+                doNotOptimize(sum);
+            };
+        });
+    }
+}
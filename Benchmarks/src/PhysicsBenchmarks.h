@@ -0,0 +1,113 @@
+#pragma once
+#include "Benchmark.h"
+#include "../../Engine/Physics/SpatialHash.h"
+#include "../../Engine/Physics/Sweep.h"
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Bench {
+    // Broadphase pair finding and proxy updates, plus the swept queries used for the ball
+    inline void registerPhysicsBenchmarks(Suite& suite) {
+        using namespace Engine::Physics;
+
+        struct Scene {
+            SpatialHash hash;
+            std::vector<float> xs, ys, velocityXs, velocityYs;
+            std::vector<std::uint32_t> proxies;
+            float radius;
+            float size;
+
+            // Density stays the same for every count: on average a handful of neighbours each
+            Scene(std::size_t count) : hash(16.0f, count), radius(4.0f), size(std::sqrt(count * 400.0f)) {
+                std::mt19937 random(11);
+                std::uniform_real_distribution<float> position(0.0f, size);
+                std::uniform_real_distribution<float> velocity(-1.0f, 1.0f);
+                for (std::size_t i = 0; i < count; i++) {
+                    xs.push_back(position(random));
+                    ys.push_back(position(random));
+                    velocityXs.push_back(velocity(random));
+                    velocityYs.push_back(velocity(random));
+                    proxies.push_back(hash.insert(AABB::fromCircle(xs[i], ys[i], radius),
+                                                  static_cast<std::uint32_t>(i)));
+                }
+            }
+        };
+
+        const std::size_t counts[] = {10000, 100000};
+        const char* countNames[] = {"10k", "100k"};
+        for (int c = 0; c < 2; c++) {
+            std::size_t count = counts[c];
+
+            suite.add(std::string("physics/spatial_hash_find_pairs_") + countNames[c], count, [count]() -> Operation {
+                auto scene = std::make_shared<Scene>(count);
+                return [scene](std::uint64_t iterations) {
+                    for (std::uint64_t n = 0; n < iterations; n++) {
+                        doNotOptimize(scene->hash.findPairs().size());
+                    }
+                };
+            });
+
+            suite.add(std::string("physics/spatial_hash_move_") + countNames[c], count, [count]() -> Operation {
+                auto scene = std::make_shared<Scene>(count);
+                return [scene](std::uint64_t iterations) {
+                    Scene& s = *scene;
+                    for (std::uint64_t n = 0; n < iterations; n++) {
+                        for (std::size_t i = 0; i < s.proxies.size(); i++) {
+                            s.xs[i] += s.velocityXs[i];
+                            s.ys[i] += s.velocityYs[i];
+                            if (s.xs[i] < 0.0f || s.xs[i] > s.size) s.velocityXs[i] = -s.velocityXs[i];
+                            if (s.ys[i] < 0.0f || s.ys[i] > s.size) s.velocityYs[i] = -s.velocityYs[i];
+                            s.hash.move(s.proxies[i], AABB::fromCircle(s.xs[i], s.ys[i], s.radius));
+                        }
+                    }
+                    doNotOptimize(s.hash.getProxyCount());
+                };
+            });
+        }
+
+        // Ball-sized queries: 1024 random starts and displacements against one paddle box
+        struct Sweeps {
+            std::vector<Engine::Math::Vector2> centers;
+            std::vector<Engine::Math::Vector2> displacements;
+            AABB paddle;
+
+            Sweeps() : paddle(AABB::fromRect(30.0f, 250.0f, 15.0f, 100.0f)) {
+                std::mt19937 random(5);
+                std::uniform_real_distribution<float> x(0.0f, 800.0f);
+                std::uniform_real_distribution<float> y(0.0f, 600.0f);
+                std::uniform_real_distribution<float> delta(-60.0f, 60.0f);
+                for (int i = 0; i < 1024; i++) {
+                    centers.emplace_back(x(random), y(random));
+                    displacements.emplace_back(delta(random), delta(random));
+                }
+            }
+        };
+
+        suite.add("physics/sweep_circle_aabb_1k", 1024, []() -> Operation {
+            auto data = std::make_shared<Sweeps>();
+            return [data](std::uint64_t iterations) {
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    for (std::size_t i = 0; i < data->centers.size(); i++) {
+                        doNotOptimize(Sweep::circleVsAABB(data->centers[i], 8.0f, data->displacements[i],
+                                                          data->paddle).time);
+                    }
+                }
+            };
+        });
+
+        suite.add("physics/sweep_circle_plane_1k", 1024, []() -> Operation {
+            auto data = std::make_shared<Sweeps>();
+            return [data](std::uint64_t iterations) {
+                for (std::uint64_t n = 0; n < iterations; n++) {
+                    for (std::size_t i = 0; i < data->centers.size(); i++) {
+                        doNotOptimize(Sweep::circleVsPlane(data->centers[i], 8.0f, data->displacements[i],
+                                                           Engine::Math::Vector2(0.0f, 1.0f), 0.0f).time);
+                    }
+                }
+            };
+        });
+    }
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include "Benchmark.h"
+#include "../../PongGame/src/PongGame.h"
+#include "../../PongGame/src/PongStressTest.h"
+#include "../../PongGame/src/PongBatchEnv.h"
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Bench {
+    // A two-player session for the replay benchmark: Enter on the main menu, then both
+    // players sweeping their paddles in turn, recorded through the real input pipeline
+    inline std::string recordScriptedSession(std::uint64_t ticks) {
+        using Key = sf::Keyboard::Key;
+        std::ostringstream out;
+        Engine::Input::InputRecorder recorder(out, 1, 1.0f / PongGame::TICKS_PER_SECOND);
+        Engine::Input::InputSystem input;
+
+        auto send = [&input](Key key, bool down) {
+            if (down) {
+                input.handleEvent(sf::Event(sf::Event::KeyPressed{key, false, false, false, false}));
+            } else {
+                input.handleEvent(sf::Event(sf::Event::KeyReleased{key, false, false, false, false}));
+            }
+        };
+
+        for (std::uint64_t tick = 0; tick < ticks; tick++) {
+            if (tick == 1 || tick == 2) {
+                send(Key::Enter, tick == 1);
+            } else if (tick % 40 == 0) {
+                std::uint64_t phase = (tick / 40) % 4;
+                send(Key::W, phase == 0);
+                send(Key::Up, phase == 1);
+                send(Key::S, phase == 2);
+                send(Key::Down, phase == 3);
+            }
+            input.beginTick();
+            recorder.record(input.getSnapshot());
+        }
+        recorder.finish();
+        return out.str();
+    }
+
+    // Pong collision logic: a whole headless tick of the real game (AI, paddles and the
+    // swept ball movement), the ECS ball collision pass with many balls, the batch
+    // environment stepping many matches at once, and the replay of a recorded session
+    inline void registerPongBenchmarks(Suite& suite) {
+        suite.add("pong/headless_tick", 1, []() -> Operation {
+            auto game = std::make_shared<PongGame>(true);
+            return [game](std::uint64_t iterations) {
+                doNotOptimize(game->runHeadless(iterations).ticks);
+            };
+        });
+
+        // One full replay per iteration: ten minutes of play at 120 ticks per second
+        const std::uint64_t replayTicks = 72000;
+        suite.add("pong/replay_session", replayTicks, [replayTicks]() -> Operation {
+            auto recording = std::make_shared<std::string>(recordScriptedSession(replayTicks));
+            return [recording](std::uint64_t iterations) {
+                for (std::uint64_t i = 0; i < iterations; i++) {
+                    std::istringstream in(*recording);
+                    Engine::Input::InputPlayer player(in);
+                    PongGame game(true, player.getSeed(), true);
+                    game.setInputPlayer(&player);
+                    doNotOptimize(game.runHeadless().ticks);
+                }
+            };
+        });
+
+        const std::size_t counts[] = {1000, 100000};
+        const char* countNames[] = {"1k", "100k"};
+        for (int c = 0; c < 2; c++) {
+            std::size_t count = counts[c];
+
+            suite.add(std::string("pong/stress_frame_") + countNames[c], count, [count]() -> Operation {
+                auto stress = std::make_shared<PongStressTest>(count, true);
+                return [stress](std::uint64_t iterations) {
+                    stress->runBenchmark(iterations);
+                    doNotOptimize(stress->getPhaseStats(PongStressTest::Frame).getSampleCount());
+                };
+            });
+        }
+
+        for (int threaded = 0; threaded < 2; threaded++) {
+            const std::size_t matches = 65536;
+            suite.add(threaded ? "pong/batch_step_64k_threaded" : "pong/batch_step_64k", matches,
+                      [matches, threaded]() -> Operation {
+                struct Batch {
+                    std::unique_ptr<Engine::Core::JobSystem> jobs;
+                    std::unique_ptr<PongBatchEnv> env;
+                    std::vector<std::int8_t> actions;
+                    std::vector<float> observations;
+                    std::vector<float> rewards;
+                    std::vector<std::uint8_t> dones;
+                };
+
+                auto batch = std::make_shared<Batch>();
+                if (threaded) {
+                    batch->jobs = std::make_unique<Engine::Core::JobSystem>();
+                }
+                batch->env = std::make_unique<PongBatchEnv>(matches, PongBatchConfig(), batch->jobs.get());
+                batch->actions.resize(matches * PongBatchEnv::ACTIONS_PER_MATCH);
+                for (std::size_t i = 0; i < batch->actions.size(); i++) {
+                    batch->actions[i] = static_cast<std::int8_t>(i % 3) - 1;
+                }
+                batch->observations.resize(matches * PongBatchEnv::OBSERVATION_SIZE);
+                batch->rewards.resize(matches);
+                batch->dones.resize(matches);
+
+                return [batch](std::uint64_t iterations) {
+                    for (std::uint64_t i = 0; i < iterations; i++) {
+                        batch->env->step(batch->actions.data(), batch->observations.data(),
+                                         batch->rewards.data(), batch->dones.data());
+                    }
+                    doNotOptimize(batch->observations[0]);
+                };
+            });
+        }
+    }
+}
@@ -0,0 +1,107 @@
+#include "Benchmark.h"
+#include "CoreBenchmarks.h"
+#include "MathBenchmarks.h"
+#include "EcsBenchmarks.h"
+#include "PhysicsBenchmarks.h"
+#include "JobBenchmarks.h"
+#include "GraphicsBenchmarks.h"
+#include "PongBenchmarks.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// benchmarks [--filter <text>] [--json <file>] [--label <text>] [--samples <n>]
+//            [--sample-ms <ms>] [--no-graphics] [--list]
+//
+// Prints a table to stdout and, with --json, writes the results for diffing between
+// engine revisions. --no-graphics skips everything that needs a window (e.g. on CI).
+int main(int argc, char* argv[]) {
+    Bench::Options options;
+    std::string jsonPath;
+    std::string label;
+    bool listOnly = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--filter" && hasValue) {
+            options.filter = argv[++i];
+        } else if (arg == "--json" && hasValue) {
+            jsonPath = argv[++i];
+        } else if (arg == "--label" && hasValue) {
+            label = argv[++i];
+        } else if (arg == "--samples" && hasValue) {
+            options.samples = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--sample-ms" && hasValue) {
+            options.sampleMilliseconds = std::atof(argv[++i]);
+        } else if (arg == "--no-graphics") {
+            options.graphics = false;
+        } else if (arg == "--list") {
+            listOnly = true;
+        } else {
+            std::cerr << "unknown argument: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    std::unique_ptr<sf::RenderWindow> window;
+    auto getWindow = [&window]() {
+        if (!window) {
+            window = std::make_unique<sf::RenderWindow>(sf::VideoMode({800, 600}), "Engine Benchmarks");
+            window->setVerticalSyncEnabled(false);
+        }
+        return window.get();
+    };
+
+    Bench::Suite suite;
+    Bench::registerCoreBenchmarks(suite);
+    Bench::registerMathBenchmarks(suite);
+    Bench::registerEcsBenchmarks(suite);
+    Bench::registerPhysicsBenchmarks(suite);
+    Bench::registerJobBenchmarks(suite);
+    Bench::registerGraphicsBenchmarks(suite, getWindow);
+    Bench::registerPongBenchmarks(suite);
+
+    if (listOnly) {
+        for (const Bench::Benchmark& benchmark : suite.getBenchmarks()) {
+            if (suite.isSelected(benchmark, options)) {
+                std::cout << benchmark.name << "\n";
+            }
+        }
+        return 0;
+    }
+
+    Bench::Suite::writeHeader(std::cout);
+    std::vector<Bench::Result> results = suite.run(options, &std::cout);
+
+    if (!jsonPath.empty()) {
+        std::vector<std::pair<std::string, std::string>> context = {
+            {"label", label},
+            {"simd_level", Engine::Math::VectorBatch::getSimdLevel() == Engine::Math::SimdLevel::AVX2 ? "avx2"
+                           : Engine::Math::VectorBatch::getSimdLevel() == Engine::Math::SimdLevel::SSE2 ? "sse2"
+                                                                                                         : "scalar"},
+            {"hardware_threads", std::to_string(std::thread::hardware_concurrency())},
+#if defined(NDEBUG)
+            {"build", "release"},
+#else
+            {"build", "debug"},
+#endif
+        };
+
+        std::ofstream file(jsonPath);
+        if (!file) {
+            std::cerr << "cannot write " << jsonPath << "\n";
+            return 1;
+        }
+        Bench::writeJson(file, context, results);
+    }
+
+    return 0;
+}
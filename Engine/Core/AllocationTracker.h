@@ -0,0 +1,103 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace Engine {
+    namespace Core {
+        // Heap activity counters; a per-frame figure is the difference of two snapshots
+        struct AllocationStats {
+            std::uint64_t allocations = 0;
+            std::uint64_t frees = 0;
+            std::uint64_t bytes = 0;
+
+            AllocationStats operator-(const AllocationStats& earlier) const {
+                AllocationStats delta;
+                delta.allocations = allocations - earlier.allocations;
+                delta.frees = frees - earlier.frees;
+                delta.bytes = bytes - earlier.bytes;
+                return delta;
+            }
+        };
+
+        // Process-wide count of global operator new/delete calls from every thread.
+        // The counters only move when the replacement operators below are compiled in:
+        // define ENGINE_TRACK_ALLOCATIONS in exactly one translation unit (the one with
+        // main) before including any engine header. Over-aligned new is not counted.
+        class AllocationTracker {
+        private:
+            struct Counters {
+                std::atomic<std::uint64_t> allocations{0};
+                std::atomic<std::uint64_t> frees{0};
+                std::atomic<std::uint64_t> bytes{0};
+            };
+
+            // Constant-initialised, so it is usable by allocations made during static init
+            static Counters& counters() {
+                static Counters instance;
+                return instance;
+            }
+
+        public:
+            static void recordAllocation(std::size_t size) {
+                Counters& c = counters();
+                c.allocations.fetch_add(1, std::memory_order_relaxed);
+                c.bytes.fetch_add(size, std::memory_order_relaxed);
+            }
+
+            static void recordFree() {
+                counters().frees.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            static AllocationStats snapshot() {
+                const Counters& c = counters();
+                AllocationStats stats;
+                stats.allocations = c.allocations.load(std::memory_order_relaxed);
+                stats.frees = c.frees.load(std::memory_order_relaxed);
+                stats.bytes = c.bytes.load(std::memory_order_relaxed);
+                return stats;
+            }
+
+            // False when the replacement operators are not linked in (nothing has been counted)
+            static bool isActive() {
+                return counters().allocations.load(std::memory_order_relaxed) != 0;
+            }
+        };
+    }
+}
+
+#if defined(ENGINE_TRACK_ALLOCATIONS)
+// Replacing the array and sized forms too keeps every new/delete pair on malloc/free;
+// the nothrow forms forward to these by default
+void* operator new(std::size_t size) {
+    Engine::Core::AllocationTracker::recordAllocation(size);
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* memory) noexcept {
+    if (memory) {
+        Engine::Core::AllocationTracker::recordFree();
+        std::free(memory);
+    }
+}
+
+void operator delete[](void* memory) noexcept {
+    ::operator delete(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    ::operator delete(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    ::operator delete(memory);
+}
+#endif
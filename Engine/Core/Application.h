@@ -1,22 +1,113 @@
 #pragma once
 #include "Window.h"
 #include "Time.h"
+#include "Profiler.h"
+#include "AllocationTracker.h"
+#include "FrameArena.h"
+#include "FramePacer.h"
 #include "../Graphics/Renderer.h"
 #include "../Input/Input.h"
+#include "../Input/InputRecording.h"
+#include "../Input/InputSystem.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
 
 namespace Engine {
     namespace Core {
+        // Simulation throughput of a headless run
+        struct HeadlessStats {
+            std::uint64_t ticks = 0;
+            double seconds = 0.0;
+            double ticksPerSecond = 0.0;
+        };
+
         class Application {
         protected:
+            // Both are nullptr in headless mode
             Window* window;
             Graphics::Renderer* renderer;
-            bool running;
+            std::atomic<bool> running;
+            bool headless;
+
+            // Fixed-timestep simulation (disabled by default: update gets the raw frame delta)
+            bool fixedTimestep;
+            float fixedDeltaTime;
+            int maxCatchUpSteps;
+            float accumulator;
+            float interpolationAlpha;
+
+            // Idle mode: while nothing animates and no input is waiting to be simulated, the
+            // loop sleeps in waitEvent instead of redrawing an unchanged screen
+            bool idleWait;
+            float idleTimeout;
+            bool inputPending;    // An event arrived that no update() has seen yet
+            bool redrawRequested;
+
+            // Ends every windowed frame on schedule and keeps frame-time histograms
+            FramePacer framePacer;
+
+            // Pipelined mode: update of frame N+1 runs on a worker thread while the main
+            // thread renders the snapshot of frame N. Events are queued for the worker.
+            bool pipelined;
+            std::thread updateThread;
+            std::mutex pipelineMutex;
+            std::condition_variable pipelineSignal;
+            bool updateRequested;
+            bool updateDone;
+            bool pipelineQuit;
+            std::vector<sf::Event> pendingEvents;
+            std::size_t updateSlot;
+            float updateDeltaTime;
+
+            // One snapshot per update() call, built from the events seen since the previous
+            // one. Owned by whichever thread runs update(): events reach it in processEvents,
+            // or on the worker in pipelined mode.
+            Input::InputSystem input;
+            // Optional and not owned: every tick's snapshot is written to the recorder,
+            // and the player's snapshots replace live input until it runs out (which stops
+            // the application)
+            Input::InputRecorder* inputRecorder;
+            Input::InputPlayer* inputPlayer;
+
+            // Reset at the top of every frame. Main thread only: in pipelined mode update()
+            // and onEvent() run on the worker and must not touch it.
+            FrameArena frameArena;
+
+            // Heap allocations made by all threads during the last completed frame
+            AllocationStats frameAllocations;
+            AllocationStats frameStartAllocations;
+            std::uint64_t frameIndex;
+            bool allocationBudgetEnabled;
+            std::uint64_t allocationBudget;
+            bool steadyFrame;
+            int steadyFrameRun;
 
         public:
-            Application(const std::string& title, unsigned int width, unsigned int height)
-                : running(false) {
-                window = new Window(title, width, height);
-                renderer = new Graphics::Renderer(window->getRenderWindow());
+            // Number of render snapshots a pipelined game keeps (one written, one drawn)
+            static constexpr std::size_t RENDER_SLOTS = 2;
+
+            // A headless application creates no window or renderer and never calls render()
+            Application(const std::string& title, unsigned int width, unsigned int height, bool headless = false)
+                : window(nullptr), renderer(nullptr), running(false), headless(headless),
+                  fixedTimestep(false), fixedDeltaTime(1.0f / 60.0f),
+                  maxCatchUpSteps(5), accumulator(0.0f), interpolationAlpha(1.0f),
+                  idleWait(false), idleTimeout(0.25f), inputPending(false), redrawRequested(true),
+                  pipelined(false), updateRequested(false), updateDone(false), pipelineQuit(false),
+                  updateSlot(0), updateDeltaTime(0.0f), inputRecorder(nullptr), inputPlayer(nullptr), frameIndex(0),
+                  allocationBudgetEnabled(false), allocationBudget(0), steadyFrame(false), steadyFrameRun(0) {
+                if (!headless) {
+                    window = new Window(title, width, height);
+                    renderer = new Graphics::Renderer(window->getRenderWindow());
+                    setFramePacing(FramePacing::TargetRate, 60.0);
+                }
                 Time::restart();
             }
 
@@ -26,40 +117,471 @@ namespace Engine {
             }
 
             void run() {
+                if (headless) {
+                    runHeadless();
+                    return;
+                }
+                if (pipelined) {
+                    runPipelined();
+                    return;
+                }
+
                 running = true;
+                Profiler::setThreadName("main");
                 onStart();
+                useRecordedTickTime();
 
                 while (window->isOpen() && running) {
+                    bool woke = false;
+                    if (shouldIdle()) {
+                        if (!waitForEvent()) {
+                            continue; // Nothing happened: skip the update and the redraw
+                        }
+                        woke = true;
+                        framePacer.restart();
+                    }
+
+                    beginFrame();
+                    ENGINE_PROFILE_SCOPE("frame");
+
                     Time::update();
                     processEvents();
-                    update(Time::getDeltaTime());
-                    render();
+
+                    simulate(woke ? getWakeDeltaTime() : Time::getDeltaTime());
+                    {
+                        ENGINE_PROFILE_SCOPE("render");
+                        renderInterpolated(interpolationAlpha);
+                    }
+                    redrawRequested = false;
+
+                    ENGINE_PROFILE_SCOPE("pace");
+                    framePacer.endFrame();
                 }
 
                 onExit();
             }
 
+            // Calls update() back to back with the fixed delta time: no events, no
+            // rendering, no frame limit. Runs tickLimit ticks, or until stop() when 0.
+            // Not instrumented, so zone overhead does not skew the throughput figure.
+            HeadlessStats runHeadless(std::uint64_t tickLimit = 0) {
+                running = true;
+                onStart();
+                useRecordedTickTime();
+
+                HeadlessStats stats;
+                auto start = std::chrono::steady_clock::now();
+
+                while (running && (tickLimit == 0 || stats.ticks < tickLimit)) {
+                    frameArena.reset();
+                    if (tick(fixedDeltaTime)) {
+                        stats.ticks++;
+                    }
+                }
+
+                stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                stats.ticksPerSecond = stats.seconds > 0.0 ? stats.ticks / stats.seconds : 0.0;
+
+                onExit();
+                return stats;
+            }
+
             void stop() {
                 running = false;
             }
 
+            bool isHeadless() const {
+                return headless;
+            }
+
+            // Set before run(); nullptr detaches. The recorder is not finished here.
+            void setInputRecorder(Input::InputRecorder* recorder) {
+                inputRecorder = recorder;
+            }
+
+            // Replays a recording tick for tick (see Input/InputRecording.h), at its recorded
+            // tick time. Together with the recorded seed this reproduces a session, headless
+            // and at full speed.
+            void setInputPlayer(Input::InputPlayer* player) {
+                inputPlayer = player;
+            }
+
+            // Must be set before run(). The game must implement extractRenderState and
+            // renderSnapshot, and render only from snapshots: update and onEvent run on
+            // the worker thread, while rendering stays on the thread that owns the window.
+            void setPipelined(bool enabled) {
+                pipelined = enabled;
+            }
+
+            bool isPipelined() const {
+                return pipelined;
+            }
+
+            // While isAnimating() is false and every input event has been simulated, the
+            // windowed loop blocks in waitEvent and skips update, render and display. The
+            // timeout bounds how long it sleeps, so stop() or an isAnimating() change without
+            // an event is noticed; a timeout on its own does not redraw.
+            void setIdleWait(bool enabled, float timeoutSeconds = 0.25f) {
+                idleWait = enabled;
+                idleTimeout = timeoutSeconds > 0.0f ? timeoutSeconds : 0.25f;
+            }
+
+            bool isIdleWait() const {
+                return idleWait;
+            }
+
+            // Uncapped, a steady targetRate frames per second (the default, at 60), or the
+            // display's vertical sync. Has no effect on a headless application.
+            void setFramePacing(FramePacing mode, double targetRate = 60.0) {
+                framePacer.setTargetRate(targetRate);
+                framePacer.setMode(mode);
+                if (window) {
+                    window->setFramerateLimit(0);
+                    window->setVerticalSyncEnabled(mode == FramePacing::VSync);
+                }
+            }
+
+            // Frame-time and work-time histograms of the windowed loop, readable at any time
+            // from the main thread
+            const FramePacer& getFramePacer() const {
+                return framePacer;
+            }
+
+            FramePacer& getFramePacer() {
+                return framePacer;
+            }
+
+            // Runs update at a constant rate, independent of the display rate. At most
+            // maxSteps updates run per frame; any backlog beyond that is dropped, so one
+            // slow frame cannot snowball into ever longer catch-up frames. A rate that is
+            // not positive falls back to 60, as in FramePacer.
+            void setFixedTimestep(float ticksPerSecond, int maxSteps = 5) {
+                fixedTimestep = true;
+                fixedDeltaTime = 1.0f / (ticksPerSecond > 0.0f ? ticksPerSecond : 60.0f);
+                maxCatchUpSteps = maxSteps > 0 ? maxSteps : 1;
+                accumulator = 0.0f;
+            }
+
+            void disableFixedTimestep() {
+                fixedTimestep = false;
+                interpolationAlpha = 1.0f;
+            }
+
+            bool isFixedTimestep() const {
+                return fixedTimestep;
+            }
+
+            float getFixedDeltaTime() const {
+                return fixedDeltaTime;
+            }
+
+            // How far the current frame is between the last two simulation ticks (0..1)
+            float getInterpolationAlpha() const {
+                return interpolationAlpha;
+            }
+
+            // Reports every steady frame (see markSteadyFrame) that makes more than
+            // maxAllocations heap allocations through onAllocationBudgetExceeded. Needs
+            // ENGINE_TRACK_ALLOCATIONS in the executable, otherwise nothing is counted.
+            void setFrameAllocationBudget(std::uint64_t maxAllocations) {
+                allocationBudgetEnabled = true;
+                allocationBudget = maxAllocations;
+            }
+
+            void disableFrameAllocationBudget() {
+                allocationBudgetEnabled = false;
+            }
+
+            // Heap allocations of the last completed frame, from every thread
+            const AllocationStats& getFrameAllocations() const {
+                return frameAllocations;
+            }
+
         protected:
+            // Call while rendering a frame that is expected not to touch the heap. The budget
+            // applies from the second consecutive steady frame on, so the first frame of a new
+            // state may still fill caches.
+            void markSteadyFrame() {
+                steadyFrame = true;
+            }
+
+            // Default: log the offending frame to stderr
+            virtual void onAllocationBudgetExceeded(std::uint64_t frame, const AllocationStats& allocations) {
+                std::cerr << "frame " << frame << ": " << allocations.allocations << " heap allocations ("
+                          << allocations.bytes << " bytes), budget " << allocationBudget << "\n";
+            }
+
+            // Whether the screen can change without input (moving objects, timers). Only asked
+            // in idle mode, on the main thread between frames while no update() runs.
+            virtual bool isAnimating() const {
+                return true;
+            }
+
+            // Draws one more frame even if idle, e.g. after a change that came from neither
+            // input nor animation. Main thread only.
+            void requestRedraw() {
+                redrawRequested = true;
+            }
+
             virtual void onStart() {}
             virtual void onExit() {}
             virtual void update(float deltaTime) = 0;
             virtual void render() = 0;
 
+            // Override instead of render() to blend between the previous and current
+            // simulation state by alpha, which is always 1 when the fixed timestep is disabled.
+            // Named apart from render() so that overriding one does not hide the other.
+            virtual void renderInterpolated(float /*alpha*/) {
+                render();
+            }
+
             void processEvents() {
+                ENGINE_PROFILE_SCOPE("processEvents");
                 while (auto event = window->pollEvent()) {
-                    if (event->is<sf::Event::Closed>()) {
-                        window->close();
+                    dispatchEvent(*event);
+                }
+            }
+
+            void dispatchEvent(const sf::Event& event) {
+                handleEngineEvent(event);
+                inputPending = true;
+                if (pipelined) {
+                    // The worker is idle whenever the main thread takes events
+                    pendingEvents.push_back(event);
+                } else {
+                    input.handleEvent(event);
+                    onEvent(event);
+                }
+            }
+
+            bool shouldIdle() const {
+                return idleWait && !inputPending && !redrawRequested && !isAnimating();
+            }
+
+            // Blocks until the next event and dispatches it; false on timeout
+            bool waitForEvent() {
+                std::optional<sf::Event> event = window->waitEvent(sf::seconds(idleTimeout));
+                if (!event) {
+                    return false;
+                }
+                dispatchEvent(*event);
+                return true;
+            }
+
+            // The time spent asleep is not simulated: the first frame after waking gets one
+            // tick (so its input is handled at once), or no time without a fixed timestep
+            float getWakeDeltaTime() const {
+                return fixedTimestep ? fixedDeltaTime : 0.0f;
+            }
+
+            // Window close, and F3 toggles the frame-time graph. Always on the main thread.
+            void handleEngineEvent(const sf::Event& event) {
+                if (event.is<sf::Event::Closed>()) {
+                    window->close();
+                }
+                if (const auto* key = event.getIf<sf::Event::KeyPressed>()) {
+                    if (key->code == sf::Keyboard::Key::F3) {
+                        renderer->setFrameGraphVisible(!renderer->isFrameGraphVisible());
                     }
-                    onEvent(*event);
                 }
             }
 
             virtual void onEvent(const sf::Event& event) {}
 
+            // Pipelined mode: copy everything needed to draw the current frame into a
+            // snapshot slot (0..RENDER_SLOTS-1). Runs on the update thread after update().
+            virtual void extractRenderState(std::size_t slot) {}
+
+            // Pipelined mode: draw and present a snapshot. Runs on the main thread and
+            // must not read live simulation state.
+            virtual void renderSnapshot(std::size_t slot) {}
+
+            void simulate(float deltaTime) {
+                ENGINE_PROFILE_SCOPE("update");
+                if (fixedTimestep) {
+                    stepFixed(deltaTime);
+                } else {
+                    tick(deltaTime);
+                }
+            }
+
+            // Every update() goes through here, so each sees a fresh input snapshot and
+            // edges (pressed, released) are reported to exactly one update. Returns false,
+            // without updating, once a replay has run out.
+            bool tick(float deltaTime) {
+                input.beginTick();
+                inputPending = false;
+                if (inputPlayer) {
+                    Input::InputSnapshot recorded;
+                    if (!inputPlayer->next(recorded)) {
+                        stop();
+                        return false;
+                    }
+                    input.setSnapshot(recorded);
+                }
+                if (inputRecorder) {
+                    inputRecorder->record(input.getSnapshot());
+                }
+                update(deltaTime);
+                return true;
+            }
+
+            // A replay steps at the recording's tick time, whatever timestep onStart() chose,
+            // or it would not play out as recorded
+            void useRecordedTickTime() {
+                if (inputPlayer && inputPlayer->getTickTime() > 0.0f) {
+                    fixedTimestep = true;
+                    fixedDeltaTime = inputPlayer->getTickTime();
+                    accumulator = 0.0f;
+                }
+            }
+
+            void runPipelined() {
+                running = true;
+                Profiler::setThreadName("main");
+                onStart();
+                useRecordedTickTime();
+
+                // Frame 0 is simulated up front so there is always a snapshot to draw
+                std::size_t renderSlot = 0;
+                Time::update();
+                processEvents();
+                simulate(Time::getDeltaTime());
+                extractRenderState(renderSlot);
+
+                pipelineQuit = false;
+                updateThread = std::thread([this]() { updateWorker(); });
+
+                while (window->isOpen() && running) {
+                    // The worker is idle here, so the game's state and the event queue can be
+                    // used without racing it
+                    bool woke = false;
+                    if (shouldIdle()) {
+                        if (!waitForEvent()) {
+                            continue;
+                        }
+                        woke = true;
+                        framePacer.restart();
+                    }
+
+                    beginFrame();
+                    ENGINE_PROFILE_SCOPE("frame");
+                    Time::update();
+                    processEvents();
+                    bool inputQueued = inputPending;
+
+                    {
+                        std::lock_guard<std::mutex> lock(pipelineMutex);
+                        updateSlot = (renderSlot + 1) % RENDER_SLOTS;
+                        updateDeltaTime = woke ? getWakeDeltaTime() : Time::getDeltaTime();
+                        updateRequested = true;
+                        updateDone = false;
+                    }
+                    pipelineSignal.notify_all();
+
+                    {
+                        ENGINE_PROFILE_SCOPE("render");
+                        renderSnapshot(renderSlot);
+                    }
+
+                    {
+                        ENGINE_PROFILE_SCOPE("waitForUpdate");
+                        std::unique_lock<std::mutex> lock(pipelineMutex);
+                        pipelineSignal.wait(lock, [this]() { return updateDone; });
+                    }
+                    renderSlot = (renderSlot + 1) % RENDER_SLOTS;
+                    // Input the worker just simulated only shows in the next snapshot drawn
+                    redrawRequested = inputQueued && !inputPending;
+
+                    ENGINE_PROFILE_SCOPE("pace");
+                    framePacer.endFrame();
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(pipelineMutex);
+                    pipelineQuit = true;
+                }
+                pipelineSignal.notify_all();
+                updateThread.join();
+
+                onExit();
+            }
+
+            void updateWorker() {
+                Profiler::setThreadName("update");
+                while (true) {
+                    {
+                        std::unique_lock<std::mutex> lock(pipelineMutex);
+                        pipelineSignal.wait(lock, [this]() { return updateRequested || pipelineQuit; });
+                        if (pipelineQuit) {
+                            return;
+                        }
+                        updateRequested = false;
+                    }
+
+                    for (const sf::Event& event : pendingEvents) {
+                        input.handleEvent(event);
+                        onEvent(event);
+                    }
+                    pendingEvents.clear();
+
+                    simulate(updateDeltaTime);
+                    extractRenderState(updateSlot);
+
+                    {
+                        std::lock_guard<std::mutex> lock(pipelineMutex);
+                        updateDone = true;
+                    }
+                    pipelineSignal.notify_all();
+                }
+            }
+
+            void stepFixed(float frameTime) {
+                accumulator += frameTime;
+
+                int steps = 0;
+                while (accumulator >= fixedDeltaTime && steps < maxCatchUpSteps) {
+                    tick(fixedDeltaTime);
+                    accumulator -= fixedDeltaTime;
+                    steps++;
+                }
+
+                if (accumulator >= fixedDeltaTime) {
+                    // Too far behind: keep the sub-tick phase, drop the rest
+                    accumulator = std::fmod(accumulator, fixedDeltaTime);
+                }
+
+                interpolationAlpha = accumulator / fixedDeltaTime;
+            }
+
+            // Closes the books on the previous frame and starts a new one
+            void beginFrame() {
+                Profiler::markFrame();
+                frameArena.reset();
+
+                AllocationStats now = AllocationTracker::snapshot();
+                if (frameIndex > 0) {
+                    frameAllocations = now - frameStartAllocations;
+                    steadyFrameRun = steadyFrame ? steadyFrameRun + 1 : 0;
+                    if (allocationBudgetEnabled && steadyFrameRun > 1 &&
+                        frameAllocations.allocations > allocationBudget) {
+                        onAllocationBudgetExceeded(frameIndex - 1, frameAllocations);
+                    }
+                }
+                frameStartAllocations = AllocationTracker::snapshot();
+                steadyFrame = false;
+                frameIndex++;
+            }
+
+            // Input of the current tick. Read it from update(), not from render().
+            Input::InputSystem& getInput() {
+                return input;
+            }
+
+            FrameArena& getFrameArena() {
+                return frameArena;
+            }
+
             Window* getWindow() {
                 return window;
             }
@@ -0,0 +1,171 @@
+#pragma once
+#include <algorithm>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Engine {
+    namespace Core {
+        // Linear (bump) allocator for data that only lives until the end of the frame:
+        // formatted strings, scratch arrays, command lists. Allocation is a pointer bump,
+        // nothing is freed individually and reset() recycles everything at once.
+        // Requests that do not fit spill into extra heap blocks; the next reset() folds
+        // them into one larger buffer, so after a few frames the arena stops touching the heap.
+        // Not thread-safe: an arena belongs to a single thread.
+        class FrameArena {
+        private:
+            std::unique_ptr<unsigned char[]> buffer;
+            std::size_t capacity;
+            std::size_t offset;
+
+            std::vector<std::unique_ptr<unsigned char[]>> overflow;
+            std::size_t overflowBytes;
+            std::size_t peak;
+
+        public:
+            explicit FrameArena(std::size_t capacity = 64 * 1024)
+                : buffer(new unsigned char[capacity]), capacity(capacity), offset(0),
+                  overflowBytes(0), peak(0) {}
+
+            FrameArena(const FrameArena&) = delete;
+            FrameArena& operator=(const FrameArena&) = delete;
+
+            void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) {
+                std::uintptr_t base = reinterpret_cast<std::uintptr_t>(buffer.get());
+                std::size_t aligned = alignUp(base + offset, alignment) - base;
+
+                if (aligned + size <= capacity) {
+                    offset = aligned + size;
+                    peak = std::max(peak, offset + overflowBytes);
+                    return buffer.get() + aligned;
+                }
+
+                // Does not fit: give it its own block until the next reset grows the buffer
+                std::size_t blockSize = size + alignment;
+                overflow.emplace_back(new unsigned char[blockSize]);
+                overflowBytes += blockSize;
+                peak = std::max(peak, offset + overflowBytes);
+
+                std::uintptr_t block = reinterpret_cast<std::uintptr_t>(overflow.back().get());
+                return reinterpret_cast<void*>(alignUp(block, alignment));
+            }
+
+            // Uninitialised storage for count objects; never destroyed, so T must be trivial
+            template<typename T>
+            T* allocateArray(std::size_t count) {
+                static_assert(std::is_trivially_destructible<T>::value, "arena memory is never destroyed");
+                return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+            }
+
+            template<typename T, typename... Args>
+            T* create(Args&&... args) {
+                static_assert(std::is_trivially_destructible<T>::value, "arena memory is never destroyed");
+                return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+            }
+
+            // printf into the arena; the result is null-terminated and valid until reset()
+            std::string_view format(const char* fmt, ...) {
+                va_list args;
+                va_start(args, fmt);
+                va_list retry;
+                va_copy(retry, args);
+
+                // Format straight into the free space; only text that does not fit there is
+                // formatted a second time, into an overflow block
+                char* text = reinterpret_cast<char*>(buffer.get() + offset);
+                std::size_t space = capacity - offset;
+                int length = std::vsnprintf(text, space, fmt, args);
+                va_end(args);
+
+                if (length < 0) {
+                    va_end(retry);
+                    return std::string_view();
+                }
+
+                std::size_t size = static_cast<std::size_t>(length) + 1;
+                if (size <= space) {
+                    offset += size;
+                    peak = std::max(peak, offset + overflowBytes);
+                } else {
+                    text = allocateArray<char>(size);
+                    std::vsnprintf(text, size, fmt, retry);
+                }
+                va_end(retry);
+                return std::string_view(text, static_cast<std::size_t>(length));
+            }
+
+            // Invalidates everything handed out since the last reset
+            void reset() {
+                if (!overflow.empty()) {
+                    capacity = std::max(capacity * 2, capacity + overflowBytes);
+                    buffer.reset(new unsigned char[capacity]);
+                    overflow.clear();
+                    overflowBytes = 0;
+                }
+                offset = 0;
+            }
+
+            // Bytes handed out since the last reset, including overflow blocks
+            std::size_t getUsed() const {
+                return offset + overflowBytes;
+            }
+
+            std::size_t getCapacity() const {
+                return capacity;
+            }
+
+            // Largest getUsed() seen so far
+            std::size_t getPeak() const {
+                return peak;
+            }
+
+        private:
+            static std::uintptr_t alignUp(std::uintptr_t value, std::size_t alignment) {
+                return (value + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+            }
+        };
+
+        // Standard allocator over a FrameArena, for scratch containers that die with the
+        // frame, e.g. std::vector<int, ArenaAllocator<int>> ids(ArenaAllocator<int>(arena)).
+        // deallocate is a no-op; the memory comes back on the arena's reset().
+        template<typename T>
+        class ArenaAllocator {
+        private:
+            FrameArena* arena;
+
+            template<typename U>
+            friend class ArenaAllocator;
+
+        public:
+            using value_type = T;
+
+            explicit ArenaAllocator(FrameArena& arena) : arena(&arena) {}
+
+            template<typename U>
+            ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+            T* allocate(std::size_t count) {
+                return static_cast<T*>(arena->allocate(sizeof(T) * count, alignof(T)));
+            }
+
+            void deallocate(T*, std::size_t) {}
+
+            template<typename U>
+            bool operator==(const ArenaAllocator<U>& other) const {
+                return arena == other.arena;
+            }
+
+            template<typename U>
+            bool operator!=(const ArenaAllocator<U>& other) const {
+                return arena != other.arena;
+            }
+        };
+    }
+}
@@ -0,0 +1,236 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace Engine {
+    namespace Core {
+        enum class FramePacing {
+            Uncapped,   // Present as fast as possible
+            TargetRate, // The pacer waits out each frame's deadline
+            VSync       // The display's refresh paces presentation; the pacer only measures
+        };
+
+        // Fixed-size histogram of durations in milliseconds: 0.05 ms buckets up to 100 ms,
+        // plus one overflow bucket. Recording is constant time and never allocates, so it
+        // can run every frame; percentiles are accurate to one bucket (the max is exact).
+        class FrameTimeHistogram {
+        public:
+            static constexpr double BUCKET_WIDTH = 0.05;
+            static constexpr std::size_t BUCKET_COUNT = 2000;
+
+        private:
+            std::uint32_t buckets[BUCKET_COUNT + 1];
+            std::uint64_t count;
+            double total;
+            double max;
+            double last;
+
+        public:
+            FrameTimeHistogram() {
+                clear();
+            }
+
+            void record(double milliseconds) {
+                double clamped = std::max(milliseconds, 0.0);
+                std::size_t bucket = std::min(static_cast<std::size_t>(clamped / BUCKET_WIDTH), BUCKET_COUNT);
+                buckets[bucket]++;
+                count++;
+                total += clamped;
+                max = std::max(max, clamped);
+                last = clamped;
+            }
+
+            void clear() {
+                std::fill(buckets, buckets + BUCKET_COUNT + 1, 0u);
+                count = 0;
+                total = 0.0;
+                max = 0.0;
+                last = 0.0;
+            }
+
+            std::uint64_t getCount() const {
+                return count;
+            }
+
+            double getMean() const {
+                return count > 0 ? total / count : 0.0;
+            }
+
+            double getMax() const {
+                return max;
+            }
+
+            // The most recent sample
+            double getLast() const {
+                return last;
+            }
+
+            // Nearest-rank percentile (percentile in 0..100), reported as the upper edge of
+            // its bucket and never above the largest sample
+            double getPercentile(double percentile) const {
+                if (count == 0) {
+                    return 0.0;
+                }
+
+                std::uint64_t rank = static_cast<std::uint64_t>(percentile / 100.0 * count + 0.999999);
+                rank = std::min(std::max<std::uint64_t>(rank, 1), count);
+
+                std::uint64_t seen = 0;
+                for (std::size_t i = 0; i <= BUCKET_COUNT; i++) {
+                    seen += buckets[i];
+                    if (seen >= rank) {
+                        return i == BUCKET_COUNT ? max : std::min((i + 1) * BUCKET_WIDTH, max);
+                    }
+                }
+                return max;
+            }
+        };
+
+        // Ends every frame on schedule and measures how well that went.
+        //
+        // In TargetRate mode endFrame() waits for the frame's deadline: it sleeps until
+        // shortly before it, then spins on the steady clock for the rest, since sleeps
+        // overshoot by anything from tens of microseconds to a scheduler quantum. The spin
+        // margin adapts to the worst overshoot seen recently. Deadlines advance by exactly one
+        // period, so a slightly late frame does not delay the ones after it; a frame more than
+        // a period late restarts the schedule instead of being chased by a burst of short frames.
+        //
+        // Every mode records the interval between frames and the part of it spent working
+        // (before the wait) in histograms that can be read at any time.
+        class FramePacer {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+        private:
+            FramePacing mode;
+            Clock::duration period;
+            Clock::duration minSpinMargin;
+            Clock::duration spinMargin;
+
+            bool started;
+            Clock::time_point deadline;
+            Clock::time_point frameStart;
+
+            FrameTimeHistogram frameTimes;
+            FrameTimeHistogram workTimes;
+            std::uint64_t missedDeadlines;
+
+        public:
+            FramePacer()
+                : mode(FramePacing::TargetRate), period(periodFor(60.0)),
+                  minSpinMargin(std::chrono::microseconds(1000)), spinMargin(minSpinMargin),
+                  started(false), missedDeadlines(0) {}
+
+            void setMode(FramePacing newMode) {
+                mode = newMode;
+                restart();
+            }
+
+            FramePacing getMode() const {
+                return mode;
+            }
+
+            // Used in TargetRate mode
+            void setTargetRate(double framesPerSecond) {
+                period = periodFor(framesPerSecond);
+                restart();
+            }
+
+            double getTargetRate() const {
+                return 1.0 / std::chrono::duration<double>(period).count();
+            }
+
+            // Minimum time spent spinning before a deadline; more is spent if sleeps overshoot
+            void setSpinMargin(double milliseconds) {
+                minSpinMargin = std::chrono::duration_cast<Clock::duration>(
+                    std::chrono::duration<double, std::milli>(std::max(milliseconds, 0.0)));
+                spinMargin = minSpinMargin;
+            }
+
+            // Call once per frame, after presenting it
+            void endFrame() {
+                Clock::time_point now = Clock::now();
+                if (!started) {
+                    started = true;
+                    frameStart = now;
+                    deadline = now + period;
+                    return;
+                }
+
+                workTimes.record(toMilliseconds(now - frameStart));
+
+                if (mode == FramePacing::TargetRate) {
+                    if (now > deadline) {
+                        missedDeadlines++;
+                    }
+                    if (now - deadline > period) {
+                        deadline = now; // Too far behind: start a new schedule from here
+                    } else {
+                        waitUntil(deadline);
+                        now = Clock::now();
+                    }
+                    deadline += period;
+                }
+
+                frameTimes.record(toMilliseconds(now - frameStart));
+                frameStart = now;
+            }
+
+            // Forgets the schedule, e.g. after the loop slept through an idle stretch; the
+            // next endFrame() starts timing afresh instead of recording the gap
+            void restart() {
+                started = false;
+            }
+
+            // Interval between the ends of consecutive frames
+            const FrameTimeHistogram& getFrameTimes() const {
+                return frameTimes;
+            }
+
+            // Part of each frame before the pacer started waiting
+            const FrameTimeHistogram& getWorkTimes() const {
+                return workTimes;
+            }
+
+            // TargetRate frames that were already late when endFrame() was called
+            std::uint64_t getMissedDeadlines() const {
+                return missedDeadlines;
+            }
+
+            void clearStats() {
+                frameTimes.clear();
+                workTimes.clear();
+                missedDeadlines = 0;
+            }
+
+        private:
+            void waitUntil(Clock::time_point target) {
+                Clock::time_point now = Clock::now();
+                if (target - now > spinMargin) {
+                    Clock::duration requested = target - now - spinMargin;
+                    std::this_thread::sleep_for(requested);
+
+                    // Grow the margin to the worst overshoot, and let it decay back slowly
+                    Clock::duration overshoot = Clock::now() - now - requested;
+                    spinMargin = std::max(minSpinMargin, std::max(overshoot, spinMargin - spinMargin / 64));
+                }
+
+                while (Clock::now() < target) {
+                    std::this_thread::yield();
+                }
+            }
+
+            static Clock::duration periodFor(double framesPerSecond) {
+                double rate = framesPerSecond > 0.0 ? framesPerSecond : 60.0;
+                return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / rate));
+            }
+
+            static double toMilliseconds(Clock::duration duration) {
+                return std::chrono::duration<double, std::milli>(duration).count();
+            }
+        };
+    }
+}
@@ -0,0 +1,246 @@
+#pragma once
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Engine {
+    namespace Core {
+        // Number of unfinished jobs in a group; JobSystem::wait returns once it reaches zero
+        class JobCounter {
+        private:
+            friend class JobSystem;
+            std::atomic<std::size_t> pending;
+
+        public:
+            JobCounter() : pending(0) {}
+
+            bool isDone() const {
+                return pending.load(std::memory_order_acquire) == 0;
+            }
+        };
+
+        // Work-stealing job system. Each worker owns a deque: it pushes and pops at the
+        // back (newest, cache-warm work first) while idle threads steal from the front.
+        // Threads that are not workers (e.g. the main thread) share queue 0 and execute
+        // jobs themselves while they wait, so waiting never wastes a core.
+        class JobSystem {
+        private:
+            struct Job {
+                void (*function)(void* data, std::size_t begin, std::size_t end);
+                void* data;
+                std::size_t begin;
+                std::size_t end;
+                JobCounter* counter;
+            };
+
+            struct WorkQueue {
+                std::mutex mutex;
+                std::deque<Job> jobs;
+            };
+
+            std::vector<std::unique_ptr<WorkQueue>> queues;
+            std::vector<std::thread> workers;
+            std::atomic<std::size_t> queuedJobs;
+            std::atomic<bool> quit;
+            std::mutex sleepMutex;
+            std::condition_variable wakeSignal;
+
+        public:
+            // workerCount 0 picks one worker per hardware thread, minus the calling thread
+            explicit JobSystem(unsigned int workerCount = 0) : queuedJobs(0), quit(false) {
+                if (workerCount == 0) {
+                    unsigned int hardware = std::thread::hardware_concurrency();
+                    workerCount = hardware > 1 ? hardware - 1 : 1;
+                }
+
+                for (unsigned int i = 0; i <= workerCount; i++) {
+                    queues.push_back(std::make_unique<WorkQueue>());
+                }
+                for (unsigned int i = 1; i <= workerCount; i++) {
+                    workers.emplace_back([this, i]() { workerLoop(i); });
+                }
+            }
+
+            ~JobSystem() {
+                {
+                    std::lock_guard<std::mutex> lock(sleepMutex);
+                    quit = true;
+                }
+                wakeSignal.notify_all();
+                for (std::thread& worker : workers) {
+                    worker.join();
+                }
+            }
+
+            JobSystem(const JobSystem&) = delete;
+            JobSystem& operator=(const JobSystem&) = delete;
+
+            // Worker threads plus the calling thread
+            unsigned int getThreadCount() const {
+                return static_cast<unsigned int>(workers.size()) + 1;
+            }
+
+            // Queues a task; the counter is incremented now and decremented when it finishes
+            void run(std::function<void()> task, JobCounter& counter) {
+                auto* owned = new std::function<void()>(std::move(task));
+                push({&invokeTask, owned, 0, 0, &counter});
+            }
+
+            // Helps execute jobs until every job counted by counter has finished
+            void wait(JobCounter& counter) {
+                std::size_t self = currentQueue();
+                while (!counter.isDone()) {
+                    Job job;
+                    if (findJob(self, job)) {
+                        execute(job);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+
+            // Calls fn(chunkBegin, chunkEnd) over [begin, end) split into chunks of at most
+            // grainSize indices, and returns when all chunks are done. fn only needs to live
+            // for the duration of the call, so no allocation is made per chunk.
+            template <typename Fn>
+            void parallelFor(std::size_t begin, std::size_t end, std::size_t grainSize, Fn&& fn) {
+                if (begin >= end) {
+                    return;
+                }
+                grainSize = std::max<std::size_t>(grainSize, 1);
+
+                JobCounter counter;
+                using Function = typename std::remove_reference<Fn>::type;
+                void* data = const_cast<void*>(static_cast<const void*>(&fn));
+                std::size_t chunkCount = (end - begin + grainSize - 1) / grainSize;
+                counter.pending.fetch_add(chunkCount, std::memory_order_relaxed);
+
+                // All chunks go in under one lock with one wake-up; idle threads steal them
+                WorkQueue& queue = *queues[currentQueue()];
+                {
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    for (std::size_t chunk = begin; chunk < end; chunk += grainSize) {
+                        queue.jobs.push_back({&invokeRange<Function>, data, chunk,
+                                              std::min(chunk + grainSize, end), &counter});
+                    }
+                }
+                queuedJobs.fetch_add(chunkCount, std::memory_order_release);
+                wakeWorkers(chunkCount > 1);
+
+                wait(counter);
+            }
+
+        private:
+            static void invokeTask(void* data, std::size_t, std::size_t) {
+                auto* task = static_cast<std::function<void()>*>(data);
+                (*task)();
+                delete task;
+            }
+
+            template <typename Function>
+            static void invokeRange(void* data, std::size_t begin, std::size_t end) {
+                (*static_cast<Function*>(data))(begin, end);
+            }
+
+            // Queue index of the calling thread: its own deque for workers, 0 otherwise
+            std::size_t currentQueue() const {
+                const JobSystem*& owner = threadOwner();
+                return owner == this ? threadQueueIndex() : 0;
+            }
+
+            static const JobSystem*& threadOwner() {
+                thread_local const JobSystem* owner = nullptr;
+                return owner;
+            }
+
+            static std::size_t& threadQueueIndex() {
+                thread_local std::size_t index = 0;
+                return index;
+            }
+
+            void push(const Job& job) {
+                job.counter->pending.fetch_add(1, std::memory_order_relaxed);
+
+                WorkQueue& queue = *queues[currentQueue()];
+                {
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    queue.jobs.push_back(job);
+                }
+                queuedJobs.fetch_add(1, std::memory_order_release);
+                wakeWorkers(false);
+            }
+
+            void wakeWorkers(bool all) {
+                // Taking the lock orders this wake-up after a worker's "queue empty" check
+                { std::lock_guard<std::mutex> lock(sleepMutex); }
+                if (all) {
+                    wakeSignal.notify_all();
+                } else {
+                    wakeSignal.notify_one();
+                }
+            }
+
+            bool findJob(std::size_t self, Job& job) {
+                // Own queue first, newest job
+                {
+                    WorkQueue& own = *queues[self];
+                    std::lock_guard<std::mutex> lock(own.mutex);
+                    if (!own.jobs.empty()) {
+                        job = own.jobs.back();
+                        own.jobs.pop_back();
+                        queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+                        return true;
+                    }
+                }
+
+                // Then steal the oldest job from someone else, starting after ourselves
+                for (std::size_t offset = 1; offset < queues.size(); offset++) {
+                    WorkQueue& victim = *queues[(self + offset) % queues.size()];
+                    std::lock_guard<std::mutex> lock(victim.mutex);
+                    if (!victim.jobs.empty()) {
+                        job = victim.jobs.front();
+                        victim.jobs.pop_front();
+                        queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            void execute(const Job& job) {
+                ENGINE_PROFILE_SCOPE("job");
+                job.function(job.data, job.begin, job.end);
+                job.counter->pending.fetch_sub(1, std::memory_order_acq_rel);
+            }
+
+            void workerLoop(std::size_t index) {
+                threadOwner() = this;
+                threadQueueIndex() = index;
+                Profiler::setThreadName("job worker " + std::to_string(index));
+
+                while (!quit) {
+                    Job job;
+                    if (findJob(index, job)) {
+                        execute(job);
+                        continue;
+                    }
+
+                    std::unique_lock<std::mutex> lock(sleepMutex);
+                    wakeSignal.wait(lock, [this]() {
+                        return quit || queuedJobs.load(std::memory_order_acquire) > 0;
+                    });
+                }
+            }
+        };
+    }
+}
@@ -0,0 +1,238 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Instrumentation is compiled in unless ENGINE_NO_INSTRUMENTATION is defined
+// (release-noinstr builds), in which case the zone macros expand to nothing.
+#if !defined(ENGINE_NO_INSTRUMENTATION)
+#define ENGINE_PROFILING 1
+#else
+#define ENGINE_PROFILING 0
+#endif
+
+#define ENGINE_PROFILE_CONCAT_INNER(a, b) a##b
+#define ENGINE_PROFILE_CONCAT(a, b) ENGINE_PROFILE_CONCAT_INNER(a, b)
+
+#if ENGINE_PROFILING
+// Times the rest of the enclosing scope; name must be a string literal (it is stored by pointer)
+#define ENGINE_PROFILE_SCOPE(name) \
+    ::Engine::Core::ProfileScope ENGINE_PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define ENGINE_PROFILE_FUNCTION() ENGINE_PROFILE_SCOPE(__FUNCTION__)
+#else
+#define ENGINE_PROFILE_SCOPE(name) ((void)0)
+#define ENGINE_PROFILE_FUNCTION() ((void)0)
+#endif
+
+namespace Engine {
+    namespace Core {
+        // One completed zone. Times are nanoseconds since the profiler started.
+        struct ProfileEvent {
+            const char* name;
+            std::uint64_t start;
+            std::uint64_t end;
+            std::uint32_t depth;
+        };
+
+        // Records zones into per-thread ring buffers and keeps a short history of frame times.
+        // Each ring has a single writer (its thread) and needs no lock; readers copy out the
+        // events and drop any the writer may have overwritten meanwhile. When a ring is full
+        // the oldest events are overwritten, so a trace always holds the most recent frames.
+        class Profiler {
+        public:
+            static constexpr std::size_t EVENTS_PER_THREAD = 1 << 16;
+            static constexpr std::size_t FRAME_HISTORY = 240;
+
+        private:
+            struct ThreadBuffer {
+                std::vector<ProfileEvent> events;
+                std::atomic<std::uint64_t> written;
+                std::uint32_t depth;
+                std::uint32_t threadId;
+                std::string threadName;
+
+                ThreadBuffer(std::uint32_t threadId)
+                    : events(EVENTS_PER_THREAD), written(0), depth(0), threadId(threadId) {}
+            };
+
+            struct State {
+                std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+                std::atomic<bool> enabled{true};
+                std::mutex threadsMutex;
+                // Kept alive after their thread exits so their events can still be exported
+                std::vector<std::shared_ptr<ThreadBuffer>> threads;
+
+                // Written by the thread that calls markFrame, read by the same thread (the graph)
+                float frameTimes[FRAME_HISTORY] = {};
+                std::size_t frameCount = 0;
+                std::uint64_t lastFrameMark = 0;
+            };
+
+            static State& state() {
+                static State instance;
+                return instance;
+            }
+
+            static ThreadBuffer& threadBuffer() {
+                thread_local std::shared_ptr<ThreadBuffer> buffer;
+                if (!buffer) {
+                    State& s = state();
+                    std::lock_guard<std::mutex> lock(s.threadsMutex);
+                    buffer = std::make_shared<ThreadBuffer>(static_cast<std::uint32_t>(s.threads.size() + 1));
+                    s.threads.push_back(buffer);
+                }
+                return *buffer;
+            }
+
+        public:
+            static std::uint64_t now() {
+                return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - state().epoch).count());
+            }
+
+            // Zones opened while disabled are not recorded; frame times are always kept
+            static void setEnabled(bool enabled) {
+                state().enabled.store(enabled, std::memory_order_relaxed);
+            }
+
+            static bool isEnabled() {
+                return state().enabled.load(std::memory_order_relaxed);
+            }
+
+            // Label for the calling thread in exported traces
+            static void setThreadName(const std::string& name) {
+                ThreadBuffer& buffer = threadBuffer();
+                std::lock_guard<std::mutex> lock(state().threadsMutex);
+                buffer.threadName = name;
+            }
+
+            // Zone bookkeeping, used by ProfileScope
+            static std::uint32_t enterZone() {
+                return threadBuffer().depth++;
+            }
+
+            static void leaveZone(const char* name, std::uint64_t start, std::uint32_t depth) {
+                ThreadBuffer& buffer = threadBuffer();
+                buffer.depth = depth;
+
+                std::uint64_t index = buffer.written.load(std::memory_order_relaxed);
+                buffer.events[index % EVENTS_PER_THREAD] = {name, start, now(), depth};
+                buffer.written.store(index + 1, std::memory_order_release);
+            }
+
+            // Call once per frame from the main loop; records the time since the previous call
+            static void markFrame() {
+                State& s = state();
+                std::uint64_t mark = now();
+                if (s.lastFrameMark != 0) {
+                    s.frameTimes[s.frameCount % FRAME_HISTORY] = (mark - s.lastFrameMark) / 1e6f;
+                    s.frameCount++;
+                }
+                s.lastFrameMark = mark;
+            }
+
+            // Frame times in milliseconds, oldest first (at most FRAME_HISTORY of them)
+            static std::size_t getFrameTimes(float* out, std::size_t capacity) {
+                State& s = state();
+                std::size_t count = std::min({s.frameCount, FRAME_HISTORY, capacity});
+                for (std::size_t i = 0; i < count; i++) {
+                    out[i] = s.frameTimes[(s.frameCount - count + i) % FRAME_HISTORY];
+                }
+                return count;
+            }
+
+            // Snapshot of every thread's recorded events, safe while the threads keep running
+            static std::vector<ProfileEvent> collect(std::vector<std::uint32_t>* threadIds = nullptr) {
+                std::vector<ProfileEvent> events;
+                std::lock_guard<std::mutex> lock(state().threadsMutex);
+
+                for (const std::shared_ptr<ThreadBuffer>& buffer : state().threads) {
+                    std::uint64_t end = buffer->written.load(std::memory_order_acquire);
+                    std::uint64_t begin = end > EVENTS_PER_THREAD ? end - EVENTS_PER_THREAD : 0;
+                    std::size_t first = events.size();
+
+                    for (std::uint64_t i = begin; i < end; i++) {
+                        events.push_back(buffer->events[i % EVENTS_PER_THREAD]);
+                    }
+
+                    // Whatever the writer wrapped over while we copied may be torn: drop it,
+                    // including the slot of event `after`, which may be mid-write right now
+                    std::uint64_t after = buffer->written.load(std::memory_order_acquire);
+                    std::uint64_t valid = after + 1 > EVENTS_PER_THREAD ? after + 1 - EVENTS_PER_THREAD : 0;
+                    std::size_t torn = static_cast<std::size_t>(std::min(end, std::max(begin, valid)) - begin);
+                    events.erase(events.begin() + first, events.begin() + first + torn);
+
+                    if (threadIds) {
+                        threadIds->resize(events.size(), buffer->threadId);
+                    }
+                }
+                return events;
+            }
+
+            // Chrome trace event format, loadable in chrome://tracing and ui.perfetto.dev
+            static void writeChromeTrace(std::ostream& out) {
+                std::vector<std::uint32_t> threadIds;
+                std::vector<ProfileEvent> events = collect(&threadIds);
+
+                out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+                bool first = true;
+
+                {
+                    std::lock_guard<std::mutex> lock(state().threadsMutex);
+                    for (const std::shared_ptr<ThreadBuffer>& buffer : state().threads) {
+                        std::string name = buffer->threadName.empty()
+                            ? "thread " + std::to_string(buffer->threadId) : buffer->threadName;
+                        out << (first ? "\n" : ",\n")
+                            << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId
+                            << ",\"args\":{\"name\":\"" << name << "\"}}";
+                        first = false;
+                    }
+                }
+
+                char line[256];
+                for (std::size_t i = 0; i < events.size(); i++) {
+                    const ProfileEvent& event = events[i];
+                    std::snprintf(line, sizeof(line),
+                                  "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                                  event.name, threadIds[i], event.start / 1000.0, (event.end - event.start) / 1000.0);
+                    out << (first ? "\n" : ",\n") << line;
+                    first = false;
+                }
+                out << "\n]}\n";
+            }
+        };
+
+        // RAII zone; use through ENGINE_PROFILE_SCOPE
+        class ProfileScope {
+        private:
+            const char* name;
+            std::uint64_t start;
+            std::uint32_t depth;
+            bool active;
+
+        public:
+            explicit ProfileScope(const char* name) : name(name), start(0), depth(0), active(Profiler::isEnabled()) {
+                if (active) {
+                    depth = Profiler::enterZone();
+                    start = Profiler::now();
+                }
+            }
+
+            ~ProfileScope() {
+                if (active) {
+                    Profiler::leaveZone(name, start, depth);
+                }
+            }
+
+            ProfileScope(const ProfileScope&) = delete;
+            ProfileScope& operator=(const ProfileScope&) = delete;
+        };
+    }
+}
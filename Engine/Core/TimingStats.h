@@ -0,0 +1,67 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace Engine {
+    namespace Core {
+        // Collects duration samples (milliseconds) and summarizes them as min / mean / percentiles
+        class TimingStats {
+        private:
+            std::vector<double> samples;
+            mutable std::vector<double> scratch;
+
+        public:
+            void reserve(std::size_t count) {
+                samples.reserve(count);
+            }
+
+            void addSample(double milliseconds) {
+                samples.push_back(milliseconds);
+            }
+
+            void clear() {
+                samples.clear();
+            }
+
+            std::size_t getSampleCount() const {
+                return samples.size();
+            }
+
+            double getMin() const {
+                return samples.empty() ? 0.0 : *std::min_element(samples.begin(), samples.end());
+            }
+
+            double getMax() const {
+                return samples.empty() ? 0.0 : *std::max_element(samples.begin(), samples.end());
+            }
+
+            double getMean() const {
+                if (samples.empty()) {
+                    return 0.0;
+                }
+
+                double total = 0.0;
+                for (double sample : samples) {
+                    total += sample;
+                }
+                return total / samples.size();
+            }
+
+            // Nearest-rank percentile, percentile in 0..100
+            double getPercentile(double percentile) const {
+                if (samples.empty()) {
+                    return 0.0;
+                }
+
+                std::size_t rank = static_cast<std::size_t>(std::ceil(percentile / 100.0 * samples.size()));
+                std::size_t index = std::min(rank > 0 ? rank - 1 : 0, samples.size() - 1);
+
+                scratch = samples;
+                std::nth_element(scratch.begin(), scratch.begin() + index, scratch.end());
+                return scratch[index];
+            }
+        };
+    }
+}
@@ -15,8 +15,8 @@ namespace Engine {
         public:
             Window(const std::string& title, unsigned int width, unsigned int height)
                 : title(title), width(width), height(height) {
+                // Unlimited: Application paces frames itself (see FramePacer)
                 window = new sf::RenderWindow(sf::VideoMode({width, height}), title);
-                window->setFramerateLimit(60);
             }
 
             ~Window() {
@@ -38,10 +38,24 @@ namespace Engine {
                 window->display();
             }
 
+            // SFML's sleep-based limiter; 0 (the default) removes the limit
+            void setFramerateLimit(unsigned int limit) {
+                window->setFramerateLimit(limit);
+            }
+
+            void setVerticalSyncEnabled(bool enabled) {
+                window->setVerticalSyncEnabled(enabled);
+            }
+
             std::optional<sf::Event> pollEvent() {
                 return window->pollEvent();
             }
 
+            // Blocks until an event arrives or the timeout passes (nullopt); a zero timeout waits forever
+            std::optional<sf::Event> waitEvent(sf::Time timeout) {
+                return window->waitEvent(timeout);
+            }
+
             void close() {
                 window->close();
             }
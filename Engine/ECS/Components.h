@@ -0,0 +1,19 @@
+#pragma once
+
+namespace Engine {
+    namespace ECS {
+        // Generic engine components - plain data, no game-specific or SFML-specific code.
+        // Each is stored in its own dense array inside World, so keep them small and trivially copyable.
+        struct Position {
+            float x, y;
+        };
+
+        struct Velocity {
+            float x, y;
+        };
+
+        // Systems hand these arrays to Math::VectorBatch as interleaved x,y floats
+        static_assert(sizeof(Position) == 2 * sizeof(float), "Position must be two packed floats");
+        static_assert(sizeof(Velocity) == 2 * sizeof(float), "Velocity must be two packed floats");
+    }
+}
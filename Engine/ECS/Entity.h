@@ -4,6 +4,8 @@
 namespace Engine {
     namespace ECS {
         // Pure, generic entity class - no game-specific or SFML-specific code
+        // Kept as a compatibility shim for object-per-entity games; large entity counts
+        // should use World with components and systems (see World.h, Systems.h)
         class Entity {
         protected:
             Math::Vector2 position;
@@ -0,0 +1,249 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Engine {
+    namespace ECS {
+        // Typed handle into a SlotMap<T>: slot index and generation packed into one word.
+        // A 32-bit handle has 20 index bits (about a million live objects) and 12 generation
+        // bits; a 64-bit handle has 32 of each. The default-constructed handle is null and
+        // never resolves.
+        template <typename T, typename Word = std::uint32_t>
+        class SlotHandle {
+            static_assert(std::is_same<Word, std::uint32_t>::value || std::is_same<Word, std::uint64_t>::value,
+                          "handles are 32 or 64 bits wide");
+
+        public:
+            static constexpr unsigned INDEX_BITS = sizeof(Word) == 4 ? 20 : 32;
+            static constexpr Word INDEX_MASK = (Word(1) << INDEX_BITS) - 1;
+            static constexpr Word MAX_GENERATION = static_cast<Word>(~Word(0)) >> INDEX_BITS;
+
+        private:
+            Word bits;
+
+        public:
+            constexpr SlotHandle() : bits(0) {}
+
+            static SlotHandle make(std::uint32_t index, Word generation) {
+                SlotHandle handle;
+                handle.bits = (generation << INDEX_BITS) | (static_cast<Word>(index) & INDEX_MASK);
+                return handle;
+            }
+
+            // Round trip through a plain integer, e.g. for serialisation
+            static SlotHandle fromBits(Word bits) {
+                SlotHandle handle;
+                handle.bits = bits;
+                return handle;
+            }
+
+            Word getBits() const {
+                return bits;
+            }
+
+            std::uint32_t index() const {
+                return static_cast<std::uint32_t>(bits & INDEX_MASK);
+            }
+
+            Word generation() const {
+                return bits >> INDEX_BITS;
+            }
+
+            // Generation 0 is never handed out
+            bool isNull() const {
+                return generation() == 0;
+            }
+
+            bool operator==(const SlotHandle& other) const {
+                return bits == other.bits;
+            }
+
+            bool operator!=(const SlotHandle& other) const {
+                return bits != other.bits;
+            }
+        };
+
+        // Owns objects of one type in a dense array and hands out generational handles.
+        // Lookup is an index plus a generation check, so a handle to an erased object
+        // resolves to nullptr instead of to whatever reused its slot. Erasing swaps the
+        // last object into the hole, which keeps iteration a linear walk over the array.
+        // Freed slots are recycled through an intrusive free list; once reserve() has
+        // sized the arrays, insert and erase do not touch the heap. A slot that runs out
+        // of generations is retired rather than risk an old handle matching again, so
+        // with 32-bit handles every 4095 reuses of a slot cost one new slot.
+        //
+        // Handles stay valid until their object is erased. Pointers from get() and
+        // iterators are invalidated by any insert or erase.
+        template <typename T, typename Word = std::uint32_t>
+        class SlotMap {
+        public:
+            using Handle = SlotHandle<T, Word>;
+
+            static constexpr std::size_t MAX_SLOTS = static_cast<std::size_t>(Handle::INDEX_MASK) + 1;
+
+        private:
+            static constexpr std::uint32_t NO_SLOT = ~std::uint32_t(0);
+
+            struct Slot {
+                // Position in values while alive, next free slot while free
+                std::uint32_t dense;
+                // 0 once the generations are used up: the slot is retired for good
+                Word generation;
+            };
+
+            std::vector<T> values;
+            std::vector<std::uint32_t> valueSlots; // values[i] lives in slots[valueSlots[i]]
+            std::vector<Slot> slots;
+            std::uint32_t freeHead;
+
+        public:
+            SlotMap() : freeHead(NO_SLOT) {}
+
+            void reserve(std::size_t count) {
+                assert(count <= MAX_SLOTS);
+                values.reserve(count);
+                valueSlots.reserve(count);
+                slots.reserve(count);
+            }
+
+            template <typename... Args>
+            Handle emplace(Args&&... args) {
+                values.emplace_back(std::forward<Args>(args)...);
+
+                std::uint32_t index;
+                if (freeHead != NO_SLOT) {
+                    index = freeHead;
+                    freeHead = slots[index].dense;
+                } else {
+                    assert(slots.size() < MAX_SLOTS && "SlotMap is full");
+                    index = static_cast<std::uint32_t>(slots.size());
+                    slots.push_back({0, 1});
+                }
+
+                slots[index].dense = static_cast<std::uint32_t>(values.size() - 1);
+                valueSlots.push_back(index);
+                return Handle::make(index, slots[index].generation);
+            }
+
+            Handle insert(T value) {
+                return emplace(std::move(value));
+            }
+
+            // Returns false when the handle was already stale
+            bool erase(Handle handle) {
+                if (!contains(handle)) {
+                    return false;
+                }
+
+                std::uint32_t index = handle.index();
+                std::uint32_t dense = slots[index].dense;
+                std::uint32_t last = static_cast<std::uint32_t>(values.size() - 1);
+                if (dense != last) {
+                    values[dense] = std::move(values[last]);
+                    valueSlots[dense] = valueSlots[last];
+                    slots[valueSlots[dense]].dense = dense;
+                }
+                values.pop_back();
+                valueSlots.pop_back();
+
+                release(index);
+                return true;
+            }
+
+            bool contains(Handle handle) const {
+                std::uint32_t index = handle.index();
+                return !handle.isNull() && index < slots.size() && slots[index].generation == handle.generation();
+            }
+
+            // nullptr for null, stale or foreign handles
+            T* get(Handle handle) {
+                return contains(handle) ? &values[slots[handle.index()].dense] : nullptr;
+            }
+
+            const T* get(Handle handle) const {
+                return contains(handle) ? &values[slots[handle.index()].dense] : nullptr;
+            }
+
+            // For handles that must be alive; asserts instead of returning nullptr
+            T& at(Handle handle) {
+                assert(contains(handle) && "stale SlotMap handle");
+                return values[slots[handle.index()].dense];
+            }
+
+            const T& at(Handle handle) const {
+                assert(contains(handle) && "stale SlotMap handle");
+                return values[slots[handle.index()].dense];
+            }
+
+            // Handle of the object at a position in the dense array (0..size()-1)
+            Handle handleAt(std::size_t position) const {
+                std::uint32_t index = valueSlots[position];
+                return Handle::make(index, slots[index].generation);
+            }
+
+            // Erases everything; every outstanding handle goes stale
+            void clear() {
+                for (std::uint32_t index : valueSlots) {
+                    release(index);
+                }
+                values.clear();
+                valueSlots.clear();
+            }
+
+            std::size_t size() const {
+                return values.size();
+            }
+
+            bool empty() const {
+                return values.empty();
+            }
+
+            std::size_t capacity() const {
+                return values.capacity();
+            }
+
+            T* data() {
+                return values.data();
+            }
+
+            const T* data() const {
+                return values.data();
+            }
+
+            // Dense iteration in storage order; must not insert or erase meanwhile
+            typename std::vector<T>::iterator begin() {
+                return values.begin();
+            }
+
+            typename std::vector<T>::iterator end() {
+                return values.end();
+            }
+
+            typename std::vector<T>::const_iterator begin() const {
+                return values.begin();
+            }
+
+            typename std::vector<T>::const_iterator end() const {
+                return values.end();
+            }
+
+        private:
+            // Bumps the generation so old handles go stale, and recycles the slot
+            void release(std::uint32_t index) {
+                Slot& slot = slots[index];
+                if (slot.generation == Handle::MAX_GENERATION) {
+                    slot.generation = 0;
+                    return;
+                }
+
+                slot.generation++;
+                slot.dense = freeHead;
+                freeHead = index;
+            }
+        };
+    }
+}
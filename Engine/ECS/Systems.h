@@ -0,0 +1,22 @@
+#pragma once
+#include "World.h"
+#include "Components.h"
+#include "../Math/VectorBatch.h"
+
+namespace Engine {
+    namespace ECS {
+        // Integrates position += velocity * dt over every entity that has both,
+        // walking each archetype's dense arrays with the SIMD batch kernels
+        class MovementSystem {
+        public:
+            static void update(World& world, float deltaTime) {
+                world.each<Position, Velocity>([deltaTime](std::size_t count, const EntityId*,
+                                                           Position* positions, Velocity* velocities) {
+                    Math::VectorBatch::integrateInterleaved(reinterpret_cast<float*>(positions),
+                                                            reinterpret_cast<const float*>(velocities),
+                                                            count, deltaTime);
+                });
+            }
+        };
+    }
+}
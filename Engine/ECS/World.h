@@ -0,0 +1,312 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Engine {
+    namespace ECS {
+        // Entity handle: slot index plus a generation that is bumped when the slot is reused
+        struct EntityId {
+            std::uint32_t index;
+            std::uint32_t generation;
+
+            bool operator==(const EntityId& other) const {
+                return index == other.index && generation == other.generation;
+            }
+
+            bool operator!=(const EntityId& other) const {
+                return !(*this == other);
+            }
+        };
+
+        static constexpr std::size_t MAX_COMPONENT_TYPES = 64;
+        using ComponentMask = std::uint64_t;
+
+        class ComponentTypeCounter {
+        protected:
+            static std::size_t next() {
+                static std::size_t counter = 0;
+                assert(counter < MAX_COMPONENT_TYPES && "Too many component types");
+                return counter++;
+            }
+        };
+
+        // Dense per-type id, assigned the first time a component type is used
+        template <typename T>
+        class ComponentType : private ComponentTypeCounter {
+        public:
+            static std::size_t id() {
+                static const std::size_t value = next();
+                return value;
+            }
+
+            static ComponentMask mask() {
+                return ComponentMask(1) << id();
+            }
+        };
+
+        // Archetype storage: every entity with exactly the same set of components lives in
+        // one archetype, and each component type is a separate contiguous array (SoA).
+        // Row i of every column belongs to entities[i].
+        class World {
+        private:
+            class ColumnBase {
+            public:
+                virtual ~ColumnBase() {}
+                virtual std::unique_ptr<ColumnBase> createEmpty() const = 0;
+                virtual void moveRowTo(std::size_t row, ColumnBase& destination) = 0;
+                virtual void swapRemove(std::size_t row) = 0;
+            };
+
+            template <typename T>
+            class Column : public ColumnBase {
+            public:
+                std::vector<T> data;
+
+                std::unique_ptr<ColumnBase> createEmpty() const override {
+                    return std::make_unique<Column<T>>();
+                }
+
+                void moveRowTo(std::size_t row, ColumnBase& destination) override {
+                    static_cast<Column<T>&>(destination).data.push_back(std::move(data[row]));
+                }
+
+                void swapRemove(std::size_t row) override {
+                    if (row != data.size() - 1) {
+                        data[row] = std::move(data.back());
+                    }
+                    data.pop_back();
+                }
+            };
+
+            struct Archetype {
+                ComponentMask mask;
+                std::vector<EntityId> entities;
+                std::unique_ptr<ColumnBase> columns[MAX_COMPONENT_TYPES];
+            };
+
+            struct EntityRecord {
+                std::uint32_t generation;
+                bool alive;
+                std::size_t archetype;
+                std::size_t row;
+            };
+
+            std::vector<std::unique_ptr<Archetype>> archetypes;
+            std::unordered_map<ComponentMask, std::size_t> archetypeByMask;
+            std::vector<EntityRecord> records;
+            std::vector<std::uint32_t> freeIndices;
+            std::size_t aliveCount;
+
+        public:
+            World() : aliveCount(0) {
+                // Archetype 0 holds entities without components
+                archetypes.push_back(std::make_unique<Archetype>());
+                archetypes[0]->mask = 0;
+                archetypeByMask[0] = 0;
+            }
+
+            World(const World&) = delete;
+            World& operator=(const World&) = delete;
+
+            // Creates an entity directly in the archetype of its initial components,
+            // so no intermediate archetype moves happen
+            template <typename... Components>
+            EntityId create(Components... components) {
+                ComponentMask mask = (ComponentMask(0) | ... | ComponentType<Components>::mask());
+                std::size_t archetypeIndex = findOrCreateArchetype<Components...>(mask);
+                Archetype& archetype = *archetypes[archetypeIndex];
+
+                EntityId id = allocateId();
+                EntityRecord& record = records[id.index];
+                record.archetype = archetypeIndex;
+                record.row = archetype.entities.size();
+
+                archetype.entities.push_back(id);
+                (getColumn<Components>(archetype).data.push_back(std::move(components)), ...);
+                return id;
+            }
+
+            void destroy(EntityId id) {
+                if (!isAlive(id)) {
+                    return;
+                }
+
+                EntityRecord& record = records[id.index];
+                removeRow(*archetypes[record.archetype], record.row);
+
+                record.alive = false;
+                record.generation++;
+                freeIndices.push_back(id.index);
+                aliveCount--;
+            }
+
+            bool isAlive(EntityId id) const {
+                return id.index < records.size() && records[id.index].alive &&
+                       records[id.index].generation == id.generation;
+            }
+
+            template <typename T>
+            bool has(EntityId id) const {
+                return isAlive(id) && (archetypes[records[id.index].archetype]->mask & ComponentType<T>::mask());
+            }
+
+            // Returns nullptr when the entity is dead or lacks the component
+            template <typename T>
+            T* get(EntityId id) {
+                if (!has<T>(id)) {
+                    return nullptr;
+                }
+                const EntityRecord& record = records[id.index];
+                return &getColumn<T>(*archetypes[record.archetype]).data[record.row];
+            }
+
+            // Adds (or overwrites) a component, moving the entity to its new archetype
+            template <typename T>
+            T& add(EntityId id, T component = T()) {
+                assert(isAlive(id));
+
+                if (T* existing = get<T>(id)) {
+                    *existing = std::move(component);
+                    return *existing;
+                }
+
+                EntityRecord& record = records[id.index];
+                ComponentMask mask = archetypes[record.archetype]->mask | ComponentType<T>::mask();
+                std::size_t destinationIndex = findOrCreateArchetype<T>(mask, record.archetype);
+                moveEntity(id, destinationIndex);
+
+                Column<T>& column = getColumn<T>(*archetypes[destinationIndex]);
+                column.data.push_back(std::move(component));
+                return column.data.back();
+            }
+
+            template <typename T>
+            void remove(EntityId id) {
+                if (!has<T>(id)) {
+                    return;
+                }
+
+                EntityRecord& record = records[id.index];
+                ComponentMask mask = archetypes[record.archetype]->mask & ~ComponentType<T>::mask();
+                std::size_t destinationIndex = findOrCreateArchetype<>(mask, record.archetype);
+                moveEntity(id, destinationIndex);
+            }
+
+            // Calls fn(count, entities, Components*...) once per archetype that has every
+            // requested component, with each pointer addressing a dense array of `count` items.
+            // Entities must not be created, destroyed or restructured from inside fn.
+            template <typename... Components, typename Fn>
+            void each(Fn&& fn) {
+                ComponentMask required = (ComponentMask(0) | ... | ComponentType<Components>::mask());
+                for (auto& archetype : archetypes) {
+                    if ((archetype->mask & required) != required || archetype->entities.empty()) {
+                        continue;
+                    }
+                    fn(archetype->entities.size(), archetype->entities.data(),
+                       getColumn<Components>(*archetype).data.data()...);
+                }
+            }
+
+            std::size_t getEntityCount() const {
+                return aliveCount;
+            }
+
+            std::size_t getArchetypeCount() const {
+                return archetypes.size();
+            }
+
+        private:
+            template <typename T>
+            static Column<T>& getColumn(Archetype& archetype) {
+                return static_cast<Column<T>&>(*archetype.columns[ComponentType<T>::id()]);
+            }
+
+            template <typename T>
+            static void ensureColumn(Archetype& archetype) {
+                if (!archetype.columns[ComponentType<T>::id()]) {
+                    archetype.columns[ComponentType<T>::id()] = std::make_unique<Column<T>>();
+                }
+            }
+
+            EntityId allocateId() {
+                std::uint32_t index;
+                if (!freeIndices.empty()) {
+                    index = freeIndices.back();
+                    freeIndices.pop_back();
+                } else {
+                    index = static_cast<std::uint32_t>(records.size());
+                    records.push_back({0, false, 0, 0});
+                }
+
+                records[index].alive = true;
+                aliveCount++;
+                return {index, records[index].generation};
+            }
+
+            // Finds the archetype for mask. Columns of a new archetype are cloned from
+            // `source` where it has them, and created from the explicit types otherwise.
+            template <typename... Components>
+            std::size_t findOrCreateArchetype(ComponentMask mask, std::size_t source = 0) {
+                auto found = archetypeByMask.find(mask);
+                if (found != archetypeByMask.end()) {
+                    return found->second;
+                }
+
+                auto archetype = std::make_unique<Archetype>();
+                archetype->mask = mask;
+
+                const Archetype& from = *archetypes[source];
+                for (std::size_t type = 0; type < MAX_COMPONENT_TYPES; type++) {
+                    if ((mask & (ComponentMask(1) << type)) && from.columns[type]) {
+                        archetype->columns[type] = from.columns[type]->createEmpty();
+                    }
+                }
+                (ensureColumn<Components>(*archetype), ...);
+
+                archetypes.push_back(std::move(archetype));
+                archetypeByMask[mask] = archetypes.size() - 1;
+                return archetypes.size() - 1;
+            }
+
+            // Moves the shared components of an entity into another archetype. Components
+            // the destination lacks are dropped; ones it adds must be pushed by the caller.
+            void moveEntity(EntityId id, std::size_t destinationIndex) {
+                EntityRecord& record = records[id.index];
+                Archetype& source = *archetypes[record.archetype];
+                Archetype& destination = *archetypes[destinationIndex];
+
+                for (std::size_t type = 0; type < MAX_COMPONENT_TYPES; type++) {
+                    if (source.columns[type] && destination.columns[type]) {
+                        source.columns[type]->moveRowTo(record.row, *destination.columns[type]);
+                    }
+                }
+
+                removeRow(source, record.row);
+
+                record.archetype = destinationIndex;
+                record.row = destination.entities.size();
+                destination.entities.push_back(id);
+            }
+
+            // Swap-removes a row and fixes up the record of the entity that filled the hole
+            void removeRow(Archetype& archetype, std::size_t row) {
+                for (auto& column : archetype.columns) {
+                    if (column) {
+                        column->swapRemove(row);
+                    }
+                }
+
+                if (row != archetype.entities.size() - 1) {
+                    archetype.entities[row] = archetype.entities.back();
+                    records[archetype.entities[row].index].row = row;
+                }
+                archetype.entities.pop_back();
+            }
+        };
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace Engine {
+    namespace Graphics {
+        // Unit-circle point tables, computed once for every supported segment count.
+        // Circles are emitted as scaled, translated copies of a table, so drawing one
+        // needs no trigonometry at all. The segment count is picked from the radius
+        // so tiny particles stay cheap and large circles stay smooth.
+        class CircleTessellation {
+        public:
+            static constexpr std::size_t MIN_SEGMENTS = 8;
+            static constexpr std::size_t MAX_SEGMENTS = 64;
+            static constexpr std::size_t SEGMENT_STEP = 4;
+
+            // Largest distance, in pixels, allowed between a chord and the true circle
+            static constexpr float MAX_ERROR = 0.25f;
+
+        private:
+            static constexpr std::size_t TABLE_COUNT = (MAX_SEGMENTS - MIN_SEGMENTS) / SEGMENT_STEP + 1;
+
+            struct Tables {
+                // Each table holds segments + 1 points; the last one repeats the first
+                std::array<std::size_t, TABLE_COUNT> offsets;
+                // Largest radius each table can draw within MAX_ERROR
+                std::array<float, TABLE_COUNT> maxRadius;
+                std::array<sf::Vector2f, (MIN_SEGMENTS + MAX_SEGMENTS) * TABLE_COUNT / 2 + TABLE_COUNT> points;
+
+                Tables() {
+                    std::size_t offset = 0;
+                    for (std::size_t t = 0; t < TABLE_COUNT; t++) {
+                        std::size_t segments = MIN_SEGMENTS + t * SEGMENT_STEP;
+                        offsets[t] = offset;
+
+                        const float step = 2.0f * 3.14159265f / segments;
+                        for (std::size_t i = 0; i < segments; i++) {
+                            points[offset + i] = {std::cos(step * i), std::sin(step * i)};
+                        }
+                        points[offset + segments] = points[offset];
+
+                        // Chord error of a segment is r * (1 - cos(pi / segments))
+                        maxRadius[t] = MAX_ERROR / (1.0f - std::cos(3.14159265f / segments));
+
+                        offset += segments + 1;
+                    }
+                }
+            };
+
+            static const Tables& getTables() {
+                // Function-local static: built once, thread-safe initialization
+                static const Tables tables;
+                return tables;
+            }
+
+        public:
+            // Smallest supported segment count whose chords stay within MAX_ERROR of the circle
+            static std::size_t segmentsForRadius(float radius) {
+                const Tables& tables = getTables();
+                for (std::size_t t = 0; t < TABLE_COUNT; t++) {
+                    if (radius <= tables.maxRadius[t]) {
+                        return MIN_SEGMENTS + t * SEGMENT_STEP;
+                    }
+                }
+                return MAX_SEGMENTS;
+            }
+
+            // Points of the unit circle for a segment count returned by segmentsForRadius
+            static const sf::Vector2f* getUnitCircle(std::size_t segments) {
+                std::size_t index = (std::clamp(segments, MIN_SEGMENTS, MAX_SEGMENTS) - MIN_SEGMENTS) / SEGMENT_STEP;
+                return &getTables().points[getTables().offsets[index]];
+            }
+        };
+    }
+}
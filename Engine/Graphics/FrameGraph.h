@@ -0,0 +1,62 @@
+#pragma once
+#include "SimpleFont.h"
+#include "../Core/Profiler.h"
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cstdio>
+
+namespace Engine {
+    namespace Graphics {
+        // On-screen bar graph of the profiler's recent frame times, newest on the right.
+        // Bars are green within the target frame time, yellow up to twice it, red beyond.
+        class FrameGraph {
+        public:
+            static void draw(sf::RenderWindow* window, float x, float y, float width, float height,
+                             float targetMilliseconds = 1000.0f / 60.0f) {
+                float frameTimes[Core::Profiler::FRAME_HISTORY];
+                std::size_t count = Core::Profiler::getFrameTimes(frameTimes, Core::Profiler::FRAME_HISTORY);
+
+                // Scratch buffer is reused across calls, like SimpleFont::drawText
+                static sf::VertexArray vertices(sf::PrimitiveType::Triangles);
+                vertices.clear();
+
+                appendQuad(vertices, x, y, width, height, sf::Color(0, 0, 0, 160));
+
+                // The vertical scale covers three target frames
+                float scale = height / (targetMilliseconds * 3.0f);
+                float barWidth = width / Core::Profiler::FRAME_HISTORY;
+                float worst = 0.0f;
+                for (std::size_t i = 0; i < count; i++) {
+                    float barHeight = std::min(frameTimes[i] * scale, height);
+                    sf::Color color = frameTimes[i] <= targetMilliseconds ? sf::Color::Green
+                                    : frameTimes[i] <= targetMilliseconds * 2.0f ? sf::Color::Yellow
+                                    : sf::Color::Red;
+                    float barX = x + width - (count - i) * barWidth;
+                    appendQuad(vertices, barX, y + height - barHeight, barWidth, barHeight, color);
+                    worst = std::max(worst, frameTimes[i]);
+                }
+
+                // Target line
+                appendQuad(vertices, x, y + height - targetMilliseconds * scale, width, 1.0f, sf::Color::White);
+                window->draw(vertices);
+
+                if (count > 0) {
+                    char label[48];
+                    std::snprintf(label, sizeof(label), "%.1f MS  MAX %.1f", frameTimes[count - 1], worst);
+                    SimpleFont::drawText(window, label, x + 4.0f, y + 4.0f, 2.0f, sf::Color::White);
+                }
+            }
+
+        private:
+            static void appendQuad(sf::VertexArray& vertices, float x, float y, float width, float height,
+                                   const sf::Color& color) {
+                vertices.append({{x, y}, color});
+                vertices.append({{x + width, y}, color});
+                vertices.append({{x, y + height}, color});
+                vertices.append({{x, y + height}, color});
+                vertices.append({{x + width, y}, color});
+                vertices.append({{x + width, y + height}, color});
+            }
+        };
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "Renderer.h"
+#include "../Core/Profiler.h"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+
+namespace Engine {
+    namespace Graphics {
+        // Content that rarely changes (backgrounds, HUD, menus), rendered once into an
+        // off-screen texture and then composited every frame as a single textured quad.
+        // The layer is redrawn only when it is dirty: after invalidate(), or when the value
+        // passed to setInputs() differs from the last one, so pack whatever the content
+        // depends on (scores, selected option, ...) into that value.
+        //
+        // The texture is transparent where nothing was drawn and is created on the first
+        // draw, so a layer owned by a headless application costs nothing. If no render
+        // texture can be created the content is drawn straight to the target every frame.
+        class RenderLayer {
+        private:
+            sf::RenderTexture texture;
+            sf::Vector2u size;
+            bool created;
+            bool unavailable;
+            bool dirty;
+            std::uint64_t inputs;
+            std::uint64_t redrawCount;
+
+        public:
+            RenderLayer(unsigned int width, unsigned int height)
+                : size(width, height), created(false), unavailable(false), dirty(true),
+                  inputs(0), redrawCount(0) {}
+
+            void setInputs(std::uint64_t newInputs) {
+                if (newInputs != inputs) {
+                    inputs = newInputs;
+                    dirty = true;
+                }
+            }
+
+            void invalidate() {
+                dirty = true;
+            }
+
+            bool isDirty() const {
+                return dirty;
+            }
+
+            // How many times the content has been rendered into the texture
+            std::uint64_t getRedrawCount() const {
+                return redrawCount;
+            }
+
+            // drawContent(sf::RenderTarget* target) draws the layer's content, either through
+            // the renderer (which is pointed at the layer meanwhile) or directly to target.
+            // It only runs when the layer is dirty. Pending renderer commands are flushed first,
+            // so the layer lands on top of everything submitted before it.
+            template <typename DrawFn>
+            void draw(Renderer& renderer, DrawFn&& drawContent) {
+                if (!created && !unavailable) {
+                    created = texture.resize(size);
+                    unavailable = !created;
+                }
+
+                if (unavailable) {
+                    renderer.flush();
+                    drawContent(renderer.getTarget());
+                    renderer.flush();
+                    return;
+                }
+
+                if (dirty) {
+                    ENGINE_PROFILE_SCOPE("redrawLayer");
+                    sf::RenderTarget* previous = renderer.setTarget(&texture);
+                    texture.clear(sf::Color::Transparent);
+                    drawContent(static_cast<sf::RenderTarget*>(&texture));
+                    renderer.setTarget(previous);
+                    texture.display();
+                    dirty = false;
+                    redrawCount++;
+                }
+
+                renderer.drawTexture(texture.getTexture(), {0.0f, 0.0f});
+            }
+        };
+    }
+}
@@ -1,47 +1,267 @@
 #pragma once
+#include "CircleTessellation.h"
+#include "FrameGraph.h"
+#include "../Core/Profiler.h"
 #include <SFML/Graphics.hpp>
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <vector>
 
 namespace Engine {
     namespace Graphics {
+        // Per-frame counters, reset every time the renderer presents a frame
+        struct RenderStats {
+            unsigned int drawCalls = 0;
+            std::size_t vertices = 0;
+            std::size_t commands = 0;
+        };
+
+        // Shapes are not drawn immediately. They are recorded into a per-frame command
+        // buffer, sorted by (layer, blend mode, primitive type) and flushed as a few large
+        // vertex-array draws. Submission order is kept only within a batch: overlapping
+        // shapes draw back to front if they share layer, blend mode and primitive type
+        // (rectangles and circles are both triangles, lines are not). Otherwise the batch
+        // order decides, e.g. a line ends up under a rectangle on the same layer even if
+        // it was submitted after it. Put shapes that must cover each other on separate layers.
+        //
+        // Anything drawn straight to the window must be preceded by flush(), otherwise
+        // the pending batched shapes would end up on top of it.
         class Renderer {
         private:
+            enum class CommandType : std::uint8_t {
+                Rectangle,
+                Circle,
+                Line
+            };
+
+            struct DrawCommand {
+                // layer (16) | blend mode (8) | primitive (8) | submission sequence (32)
+                std::uint64_t sortKey;
+                CommandType type;
+                sf::Vector2f a; // Rectangle: position, Circle: center, Line: start
+                sf::Vector2f b; // Rectangle: size, Circle: (radius, 0), Line: end
+                sf::Color color;
+            };
+
+            static constexpr std::size_t MAX_BLEND_MODES = 256;
+
             sf::RenderWindow* window;
+            sf::RenderTarget* target; // The window, or an off-screen layer being redrawn
+
+            std::vector<DrawCommand> commands;
+            std::vector<sf::Vertex> vertices;
+            std::vector<sf::BlendMode> blendModes;
+            std::uint32_t sequence;
+            int layer;
+            std::uint8_t blendIndex;
+
+            RenderStats stats;
+            RenderStats lastFrameStats;
+            bool frameGraphVisible;
 
         public:
-            Renderer(sf::RenderWindow* window) : window(window) {}
+            Renderer(sf::RenderWindow* window)
+                : window(window), target(window), sequence(0), layer(0), blendIndex(0), frameGraphVisible(false) {
+                blendModes.push_back(sf::BlendAlpha);
+            }
 
             void drawRectangle(const sf::Vector2f& position, const sf::Vector2f& size, const sf::Color& color) {
-                sf::RectangleShape rect(size);
-                rect.setPosition(position);
-                rect.setFillColor(color);
-                window->draw(rect);
+                record(CommandType::Rectangle, sf::PrimitiveType::Triangles, position, size, color);
             }
 
             void drawCircle(const sf::Vector2f& position, float radius, const sf::Color& color) {
-                sf::CircleShape circle(radius);
-                circle.setPosition(position - sf::Vector2f(radius, radius));
-                circle.setFillColor(color);
-                window->draw(circle);
+                record(CommandType::Circle, sf::PrimitiveType::Triangles, position, {radius, 0.0f}, color);
             }
 
             void drawText(const std::string& text, const sf::Vector2f& position,
                          const sf::Font& font, unsigned int size, const sf::Color& color) {
+                // sf::Text owns its glyph texture, so it cannot join a shape batch
+                flush();
+
                 sf::Text textObj(font);
                 textObj.setString(text);
                 textObj.setCharacterSize(size);
                 textObj.setFillColor(color);
                 textObj.setPosition(position);
-                window->draw(textObj);
+                target->draw(textObj);
+                stats.drawCalls++;
+            }
+
+            // One textured quad at the texture's own size, e.g. a cached RenderLayer
+            void drawTexture(const sf::Texture& texture, const sf::Vector2f& position) {
+                flush();
+
+                sf::Vector2f size(static_cast<float>(texture.getSize().x), static_cast<float>(texture.getSize().y));
+                sf::Vertex quad[4] = {
+                    {position, sf::Color::White, {0.0f, 0.0f}},
+                    {{position.x + size.x, position.y}, sf::Color::White, {size.x, 0.0f}},
+                    {{position.x, position.y + size.y}, sf::Color::White, {0.0f, size.y}},
+                    {position + size, sf::Color::White, size}
+                };
+                target->draw(quad, 4, sf::PrimitiveType::TriangleStrip, sf::RenderStates(&texture));
+
+                stats.drawCalls++;
+                stats.vertices += 4;
             }
 
             void drawLine(const sf::Vector2f& start, const sf::Vector2f& end,
                          const sf::Color& color, float thickness = 1.0f) {
-                std::array<sf::Vertex, 2> line = {{
-                    {start, color},
-                    {end, color}
-                }};
-                window->draw(line.data(), 2, sf::PrimitiveType::Lines);
+                record(CommandType::Line, sf::PrimitiveType::Lines, start, end, color);
+            }
+
+            // Layers are drawn in ascending order; the default layer is 0
+            void setLayer(int newLayer) {
+                layer = std::clamp(newLayer, -32768, 32767);
+            }
+
+            int getLayer() const {
+                return layer;
+            }
+
+            void setBlendMode(const sf::BlendMode& mode) {
+                for (std::size_t i = 0; i < blendModes.size(); i++) {
+                    if (blendModes[i] == mode) {
+                        blendIndex = static_cast<std::uint8_t>(i);
+                        return;
+                    }
+                }
+
+                if (blendModes.size() == MAX_BLEND_MODES) {
+                    // Pending commands index into the table, so drain them before recycling it
+                    flush();
+                    blendModes.clear();
+                }
+
+                blendModes.push_back(mode);
+                blendIndex = static_cast<std::uint8_t>(blendModes.size() - 1);
+            }
+
+            // Sends everything after this call to another target; pending commands are
+            // flushed to the old one first. Returns the previous target.
+            sf::RenderTarget* setTarget(sf::RenderTarget* newTarget) {
+                flush();
+                sf::RenderTarget* previous = target;
+                target = newTarget;
+                return previous;
+            }
+
+            sf::RenderTarget* getTarget() const {
+                return target;
+            }
+
+            // Sorts and submits every recorded command
+            void flush() {
+                if (commands.empty()) {
+                    return;
+                }
+                ENGINE_PROFILE_SCOPE("flush");
+
+                std::sort(commands.begin(), commands.end(),
+                          [](const DrawCommand& lhs, const DrawCommand& rhs) {
+                              return lhs.sortKey < rhs.sortKey;
+                          });
+
+                std::uint32_t batchKey = static_cast<std::uint32_t>(commands.front().sortKey >> 32);
+                for (const DrawCommand& command : commands) {
+                    std::uint32_t key = static_cast<std::uint32_t>(command.sortKey >> 32);
+                    if (key != batchKey) {
+                        submit(batchKey);
+                        batchKey = key;
+                    }
+                    appendVertices(command);
+                }
+                submit(batchKey);
+
+                commands.clear();
+                sequence = 0;
+            }
+
+            // Flushes pending commands, draws the frame graph if enabled and presents the frame
+            void display() {
+                flush();
+                if (frameGraphVisible) {
+                    FrameGraph::draw(window, 10.0f, window->getSize().y - 70.0f, 240.0f, 60.0f);
+                }
+
+                {
+                    ENGINE_PROFILE_SCOPE("display");
+                    window->display();
+                }
+
+                lastFrameStats = stats;
+                stats = RenderStats();
+            }
+
+            // Overlay of recent frame times (see FrameGraph), drawn on top of everything
+            void setFrameGraphVisible(bool visible) {
+                frameGraphVisible = visible;
+            }
+
+            bool isFrameGraphVisible() const {
+                return frameGraphVisible;
+            }
+
+            // Counters for the last presented frame
+            const RenderStats& getFrameStats() const {
+                return lastFrameStats;
+            }
+
+        private:
+            void record(CommandType type, sf::PrimitiveType primitive,
+                        const sf::Vector2f& a, const sf::Vector2f& b, const sf::Color& color) {
+                std::uint64_t batchKey =
+                    (static_cast<std::uint64_t>(static_cast<std::uint16_t>(layer + 32768)) << 16) |
+                    (static_cast<std::uint64_t>(blendIndex) << 8) |
+                    static_cast<std::uint64_t>(primitive);
+
+                commands.push_back({(batchKey << 32) | sequence++, type, a, b, color});
+                stats.commands++;
+            }
+
+            void appendVertices(const DrawCommand& command) {
+                switch (command.type) {
+                    case CommandType::Rectangle: {
+                        sf::Vector2f topLeft = command.a;
+                        sf::Vector2f bottomRight = command.a + command.b;
+                        vertices.push_back({topLeft, command.color});
+                        vertices.push_back({{bottomRight.x, topLeft.y}, command.color});
+                        vertices.push_back({{topLeft.x, bottomRight.y}, command.color});
+                        vertices.push_back({{topLeft.x, bottomRight.y}, command.color});
+                        vertices.push_back({{bottomRight.x, topLeft.y}, command.color});
+                        vertices.push_back({bottomRight, command.color});
+                        break;
+                    }
+                    case CommandType::Circle: {
+                        float radius = command.b.x;
+                        std::size_t segments = CircleTessellation::segmentsForRadius(radius);
+                        const sf::Vector2f* unitCircle = CircleTessellation::getUnitCircle(segments);
+                        for (std::size_t i = 0; i < segments; i++) {
+                            vertices.push_back({command.a, command.color});
+                            vertices.push_back({command.a + unitCircle[i] * radius, command.color});
+                            vertices.push_back({command.a + unitCircle[i + 1] * radius, command.color});
+                        }
+                        break;
+                    }
+                    case CommandType::Line:
+                        vertices.push_back({command.a, command.color});
+                        vertices.push_back({command.b, command.color});
+                        break;
+                }
+            }
+
+            void submit(std::uint32_t batchKey) {
+                if (vertices.empty()) {
+                    return;
+                }
+
+                sf::PrimitiveType primitive = static_cast<sf::PrimitiveType>(batchKey & 0xFF);
+                sf::RenderStates states(blendModes[(batchKey >> 8) & 0xFF]);
+                target->draw(vertices.data(), vertices.size(), primitive, states);
+
+                stats.drawCalls++;
+                stats.vertices += vertices.size();
+                vertices.clear();
             }
         };
     }
@@ -1,12 +1,13 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <string>
+#include <string_view>
 
 namespace Engine {
     namespace Graphics {
         class SimpleFont {
         public:
-            // 5x7 bitmap font patterns for uppercase letters and digits
+            // 5x7 bitmap font patterns for uppercase letters, digits and a little punctuation
             static const bool* getCharPattern(char c) {
                 static const bool patterns[][35] = {
                     // A
@@ -233,6 +234,94 @@ namespace Engine {
                      0,1,0,0,0,
                      1,0,0,0,0,
                      1,0,0,0,0},
+                    // 0
+                    {0,1,1,1,0,
+                     1,0,0,0,1,
+                     1,0,0,1,1,
+                     1,0,1,0,1,
+                     1,1,0,0,1,
+                     1,0,0,0,1,
+                     0,1,1,1,0},
+                    // 1
+                    {0,0,1,0,0,
+                     0,1,1,0,0,
+                     0,0,1,0,0,
+                     0,0,1,0,0,
+                     0,0,1,0,0,
+                     0,0,1,0,0,
+                     0,1,1,1,0},
+                    // 2
+                    {0,1,1,1,0,
+                     1,0,0,0,1,
+                     0,0,0,0,1,
+                     0,0,0,1,0,
+                     0,0,1,0,0,
+                     0,1,0,0,0,
+                     1,1,1,1,1},
+                    // 3
+                    {1,1,1,1,0,
+                     0,0,0,0,1,
+                     0,0,0,0,1,
+                     0,1,1,1,0,
+                     0,0,0,0,1,
+                     0,0,0,0,1,
+                     1,1,1,1,0},
+                    // 4
+                    {0,0,0,1,0,
+                     0,0,1,1,0,
+                     0,1,0,1,0,
+                     1,0,0,1,0,
+                     1,1,1,1,1,
+                     0,0,0,1,0,
+                     0,0,0,1,0},
+                    // 5
+                    {1,1,1,1,1,
+                     1,0,0,0,0,
+                     1,1,1,1,0,
+                     0,0,0,0,1,
+                     0,0,0,0,1,
+                     1,0,0,0,1,
+                     0,1,1,1,0},
+                    // 6
+                    {0,0,1,1,0,
+                     0,1,0,0,0,
+                     1,0,0,0,0,
+                     1,1,1,1,0,
+                     1,0,0,0,1,
+                     1,0,0,0,1,
+                     0,1,1,1,0},
+                    // 7
+                    {1,1,1,1,1,
+                     0,0,0,0,1,
+                     0,0,0,1,0,
+                     0,0,1,0,0,
+                     0,1,0,0,0,
+                     0,1,0,0,0,
+                     0,1,0,0,0},
+                    // 8
+                    {0,1,1,1,0,
+                     1,0,0,0,1,
+                     1,0,0,0,1,
+                     0,1,1,1,0,
+                     1,0,0,0,1,
+                     1,0,0,0,1,
+                     0,1,1,1,0},
+                    // 9
+                    {0,1,1,1,0,
+                     1,0,0,0,1,
+                     1,0,0,0,1,
+                     0,1,1,1,1,
+                     0,0,0,0,1,
+                     0,0,0,1,0,
+                     0,1,1,0,0},
+                    // . (period)
+                    {0,0,0,0,0,
+                     0,0,0,0,0,
+                     0,0,0,0,0,
+                     0,0,0,0,0,
+                     0,0,0,0,0,
+                     0,1,1,0,0,
+                     0,1,1,0,0},
                 };
 
                 int index = -1;
@@ -244,9 +333,13 @@ namespace Engine {
                     index = 26;
                 } else if (c == '/') {
                     index = 27;
+                } else if (c >= '0' && c <= '9') {
+                    index = 28 + (c - '0');
+                } else if (c == '.') {
+                    index = 38;
                 }
 
-                if (index >= 0 && index < 28) {
+                if (index >= 0 && index < 39) {
                     return patterns[index];
                 }
 
@@ -255,8 +348,11 @@ namespace Engine {
                 return empty;
             }
 
-            static void drawText(sf::RenderWindow* window, const std::string& text,
-                               float x, float y, float pixelSize, const sf::Color& color) {
+            // Appends the glyph quads for a text run to a caller-owned vertex buffer.
+            // Each horizontal run of lit pixels becomes one quad (two triangles), so the
+            // whole string can be submitted with a single draw call.
+            static void appendText(sf::VertexArray& vertices, std::string_view text,
+                                   float x, float y, float pixelSize, const sf::Color& color) {
                 float currentX = x;
 
                 for (char c : text) {
@@ -267,15 +363,30 @@ namespace Engine {
 
                     const bool* pattern = getCharPattern(c);
 
-                    // Draw 5x7 character
                     for (int row = 0; row < 7; row++) {
-                        for (int col = 0; col < 5; col++) {
-                            if (pattern[row * 5 + col]) {
-                                sf::RectangleShape pixel({pixelSize, pixelSize});
-                                pixel.setPosition({currentX + col * pixelSize, y + row * pixelSize});
-                                pixel.setFillColor(color);
-                                window->draw(pixel);
+                        int col = 0;
+                        while (col < 5) {
+                            if (!pattern[row * 5 + col]) {
+                                col++;
+                                continue;
+                            }
+
+                            int runStart = col;
+                            while (col < 5 && pattern[row * 5 + col]) {
+                                col++;
                             }
+
+                            float left = currentX + runStart * pixelSize;
+                            float right = currentX + col * pixelSize;
+                            float top = y + row * pixelSize;
+                            float bottom = top + pixelSize;
+
+                            vertices.append({{left, top}, color});
+                            vertices.append({{right, top}, color});
+                            vertices.append({{left, bottom}, color});
+                            vertices.append({{left, bottom}, color});
+                            vertices.append({{right, top}, color});
+                            vertices.append({{right, bottom}, color});
                         }
                     }
 
@@ -283,22 +394,29 @@ namespace Engine {
                 }
             }
 
-            static float getTextWidth(const std::string& text, float pixelSize) {
-                float width = 0;
-                for (char c : text) {
-                    if (c == ' ') {
-                        width += 6 * pixelSize;
-                    } else {
-                        width += 6 * pixelSize;
-                    }
+            static void drawText(sf::RenderTarget* target, std::string_view text,
+                               float x, float y, float pixelSize, const sf::Color& color) {
+                // Scratch buffer is reused across calls so its storage is only grown, never reallocated per frame
+                static sf::VertexArray vertices(sf::PrimitiveType::Triangles);
+                vertices.clear();
+
+                appendText(vertices, text, x, y, pixelSize, color);
+
+                if (vertices.getVertexCount() > 0) {
+                    target->draw(vertices);
                 }
+            }
+
+            static float getTextWidth(std::string_view text, float pixelSize) {
+                // Every glyph (including space) advances by 5 pixels + 1 spacing
+                float width = static_cast<float>(text.size()) * 6 * pixelSize;
                 return width - pixelSize; // Remove last spacing
             }
 
-            static void drawTextCentered(sf::RenderWindow* window, const std::string& text,
+            static void drawTextCentered(sf::RenderTarget* target, std::string_view text,
                                         float centerX, float y, float pixelSize, const sf::Color& color) {
                 float width = getTextWidth(text, pixelSize);
-                drawText(window, text, centerX - width / 2.0f, y, pixelSize, color);
+                drawText(target, text, centerX - width / 2.0f, y, pixelSize, color);
             }
         };
     }
@@ -0,0 +1,145 @@
+#pragma once
+#include "SimpleFont.h"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Engine {
+    namespace Graphics {
+        // Retained SimpleFont text meshes keyed by (text, pixelSize, color).
+        // Geometry is built once at the origin and drawn with a translation, so a
+        // label that stays the same costs one lookup and one draw call per frame.
+        // Least recently used meshes are evicted once the memory budget is exceeded.
+        class TextCache {
+        private:
+            struct Key {
+                std::string text;
+                float pixelSize;
+                std::uint32_t color;
+
+                bool operator==(const Key& other) const {
+                    return pixelSize == other.pixelSize && color == other.color && text == other.text;
+                }
+            };
+
+            struct KeyHash {
+                std::size_t operator()(const Key& key) const {
+                    std::size_t hash = std::hash<std::string>()(key.text);
+                    hash ^= std::hash<float>()(key.pixelSize) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+                    hash ^= std::hash<std::uint32_t>()(key.color) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+                    return hash;
+                }
+            };
+
+            struct Entry {
+                Key key;
+                sf::VertexArray vertices;
+                float width;
+                std::size_t bytes;
+            };
+
+            // Front of the list is the most recently used mesh
+            std::list<Entry> entries;
+            std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> lookup;
+            std::size_t memoryBudget;
+            std::size_t memoryUsed;
+
+            // Reused for lookups so a cache hit does not allocate a key string
+            Key lookupKey;
+
+        public:
+            explicit TextCache(std::size_t memoryBudget = 256 * 1024)
+                : memoryBudget(memoryBudget), memoryUsed(0), lookupKey{std::string(), 0.0f, 0} {}
+
+            void drawText(sf::RenderTarget* target, std::string_view text,
+                          float x, float y, float pixelSize, const sf::Color& color) {
+                const Entry& entry = acquire(text, pixelSize, color);
+                if (entry.vertices.getVertexCount() == 0) {
+                    return;
+                }
+
+                sf::RenderStates states;
+                states.transform.translate({x, y});
+                target->draw(entry.vertices, states);
+            }
+
+            void drawTextCentered(sf::RenderTarget* target, std::string_view text,
+                                  float centerX, float y, float pixelSize, const sf::Color& color) {
+                const Entry& entry = acquire(text, pixelSize, color);
+                if (entry.vertices.getVertexCount() == 0) {
+                    return;
+                }
+
+                sf::RenderStates states;
+                states.transform.translate({centerX - entry.width / 2.0f, y});
+                target->draw(entry.vertices, states);
+            }
+
+            float getTextWidth(std::string_view text, float pixelSize, const sf::Color& color) {
+                return acquire(text, pixelSize, color).width;
+            }
+
+            void clear() {
+                entries.clear();
+                lookup.clear();
+                memoryUsed = 0;
+            }
+
+            void setMemoryBudget(std::size_t budget) {
+                memoryBudget = budget;
+                evict();
+            }
+
+            std::size_t getMemoryBudget() const {
+                return memoryBudget;
+            }
+
+            std::size_t getMemoryUsed() const {
+                return memoryUsed;
+            }
+
+            std::size_t getEntryCount() const {
+                return entries.size();
+            }
+
+        private:
+            const Entry& acquire(std::string_view text, float pixelSize, const sf::Color& color) {
+                lookupKey.text.assign(text.data(), text.size());
+                lookupKey.pixelSize = pixelSize;
+                lookupKey.color = color.toInteger();
+
+                auto found = lookup.find(lookupKey);
+                if (found != lookup.end()) {
+                    entries.splice(entries.begin(), entries, found->second);
+                    return *found->second;
+                }
+
+                Entry entry{lookupKey, sf::VertexArray(sf::PrimitiveType::Triangles), 0.0f, 0};
+                SimpleFont::appendText(entry.vertices, text, 0.0f, 0.0f, pixelSize, color);
+                entry.width = SimpleFont::getTextWidth(text, pixelSize);
+                entry.bytes = sizeof(Entry) + text.size() * 2 + entry.vertices.getVertexCount() * sizeof(sf::Vertex);
+
+                entries.push_front(std::move(entry));
+                lookup.emplace(lookupKey, entries.begin());
+                memoryUsed += entries.front().bytes;
+
+                evict();
+                return entries.front();
+            }
+
+            void evict() {
+                // Never evict the most recent entry, it may be drawn right now
+                while (memoryUsed > memoryBudget && entries.size() > 1) {
+                    Entry& last = entries.back();
+                    memoryUsed -= last.bytes;
+                    lookup.erase(last.key);
+                    entries.pop_back();
+                }
+            }
+        };
+    }
+}
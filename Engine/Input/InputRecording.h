@@ -0,0 +1,351 @@
+#pragma once
+#include "InputSnapshot.h"
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+namespace Engine {
+    namespace Input {
+        // Binary input recording, little-endian:
+        //   header:  "PINP", u32 version, u64 seed, u32 tick time (float bits)
+        //   records: varint ticks, then the snapshot those ticks saw as a varint mask of the
+        //            fields that differ from the previous record followed by those fields
+        //            (bit sets as one varint per word, mouse coordinates as zigzag varints)
+        //   end:     varint 0
+        // Idle stretches collapse into a single record, so an hour of play is typically
+        // well under a megabyte. A file cut short (e.g. by a crash) replays up to the last
+        // complete record.
+        namespace Recording {
+            static constexpr char MAGIC[4] = {'P', 'I', 'N', 'P'};
+            static constexpr std::uint32_t VERSION = 2; // 2: repeated keys
+            static constexpr std::size_t HEADER_SIZE = 20;
+
+            enum Field : std::uint16_t {
+                HeldKeys = 1 << 0,
+                PressedKeys = 1 << 1,
+                ReleasedKeys = 1 << 2,
+                HeldButtons = 1 << 3,
+                PressedButtons = 1 << 4,
+                ReleasedButtons = 1 << 5,
+                MouseX = 1 << 6,
+                MouseY = 1 << 7,
+                RepeatedKeys = 1 << 8
+            };
+
+            // Worst case of one record: tick count, mask, seven bit sets and two coordinates
+            static constexpr std::size_t MAX_RECORD_SIZE =
+                10 + 2 + 10 * (4 * KeySet::WORDS + 3 * ButtonSet::WORDS) + 2 * 5;
+        }
+
+        // Streams the snapshot of every tick to an std::ostream through a fixed buffer;
+        // record() never allocates. The output stream must stay open until finish().
+        class InputRecorder {
+        public:
+            static constexpr std::size_t BUFFER_SIZE = 4096;
+
+        private:
+            std::ostream* out;
+            unsigned char buffer[BUFFER_SIZE];
+            std::size_t used;
+
+            InputSnapshot written; // Last snapshot encoded into the stream
+            InputSnapshot pending; // Snapshot of the current run of identical ticks
+            std::uint64_t pendingTicks;
+            std::uint64_t tickCount;
+            std::uint64_t bytesWritten;
+            bool finished;
+
+        public:
+            InputRecorder(std::ostream& out, std::uint64_t seed, float tickTime)
+                : out(&out), used(0), pendingTicks(0), tickCount(0), bytesWritten(0), finished(false) {
+                std::memcpy(buffer, Recording::MAGIC, sizeof(Recording::MAGIC));
+                used = sizeof(Recording::MAGIC);
+                putFixed(Recording::VERSION, 4);
+                putFixed(seed, 8);
+                std::uint32_t tickBits;
+                std::memcpy(&tickBits, &tickTime, sizeof(tickBits));
+                putFixed(tickBits, 4);
+            }
+
+            InputRecorder(const InputRecorder&) = delete;
+            InputRecorder& operator=(const InputRecorder&) = delete;
+
+            ~InputRecorder() {
+                finish();
+            }
+
+            void record(const InputSnapshot& snapshot) {
+                if (pendingTicks > 0 && snapshot != pending) {
+                    writeRecord();
+                }
+                if (pendingTicks == 0) {
+                    pending = snapshot;
+                }
+                pendingTicks++;
+                tickCount++;
+            }
+
+            // Writes the last run and the end marker and flushes; later records are ignored
+            void finish() {
+                if (finished) {
+                    return;
+                }
+                if (pendingTicks > 0) {
+                    writeRecord();
+                }
+                // A worst-case last record can fill the buffer exactly
+                if (used == BUFFER_SIZE) {
+                    flush();
+                }
+                putVarint(0);
+                flush();
+                out->flush();
+                finished = true;
+            }
+
+            std::uint64_t getTickCount() const {
+                return tickCount;
+            }
+
+            // Size of the recording so far, including the tail still in the buffer
+            std::uint64_t getBytesWritten() const {
+                return bytesWritten + used;
+            }
+
+            bool good() const {
+                return out->good();
+            }
+
+        private:
+            void writeRecord() {
+                if (finished) {
+                    return;
+                }
+                if (used + Recording::MAX_RECORD_SIZE > BUFFER_SIZE) {
+                    flush();
+                }
+
+                std::uint16_t mask = 0;
+                mask |= pending.heldKeys != written.heldKeys ? Recording::HeldKeys : 0;
+                mask |= pending.pressedKeys != written.pressedKeys ? Recording::PressedKeys : 0;
+                mask |= pending.releasedKeys != written.releasedKeys ? Recording::ReleasedKeys : 0;
+                mask |= pending.repeatedKeys != written.repeatedKeys ? Recording::RepeatedKeys : 0;
+                mask |= pending.heldButtons != written.heldButtons ? Recording::HeldButtons : 0;
+                mask |= pending.pressedButtons != written.pressedButtons ? Recording::PressedButtons : 0;
+                mask |= pending.releasedButtons != written.releasedButtons ? Recording::ReleasedButtons : 0;
+                mask |= pending.mouseX != written.mouseX ? Recording::MouseX : 0;
+                mask |= pending.mouseY != written.mouseY ? Recording::MouseY : 0;
+
+                putVarint(pendingTicks);
+                putVarint(mask);
+                if (mask & Recording::HeldKeys) putBits(pending.heldKeys);
+                if (mask & Recording::PressedKeys) putBits(pending.pressedKeys);
+                if (mask & Recording::ReleasedKeys) putBits(pending.releasedKeys);
+                if (mask & Recording::RepeatedKeys) putBits(pending.repeatedKeys);
+                if (mask & Recording::HeldButtons) putBits(pending.heldButtons);
+                if (mask & Recording::PressedButtons) putBits(pending.pressedButtons);
+                if (mask & Recording::ReleasedButtons) putBits(pending.releasedButtons);
+                if (mask & Recording::MouseX) putSigned(pending.mouseX);
+                if (mask & Recording::MouseY) putSigned(pending.mouseY);
+
+                written = pending;
+                pendingTicks = 0;
+            }
+
+            template <std::size_t BITS>
+            void putBits(const BitSet<BITS>& bits) {
+                for (std::size_t i = 0; i < BitSet<BITS>::WORDS; i++) {
+                    putVarint(bits.words[i]);
+                }
+            }
+
+            void putSigned(std::int32_t value) {
+                std::uint32_t bits = static_cast<std::uint32_t>(value);
+                putVarint((bits << 1) ^ (0u - (bits >> 31)));
+            }
+
+            void putVarint(std::uint64_t value) {
+                while (value >= 0x80) {
+                    buffer[used++] = static_cast<unsigned char>(value | 0x80);
+                    value >>= 7;
+                }
+                buffer[used++] = static_cast<unsigned char>(value);
+            }
+
+            void putFixed(std::uint64_t value, int bytes) {
+                for (int i = 0; i < bytes; i++) {
+                    buffer[used++] = static_cast<unsigned char>(value >> (8 * i));
+                }
+            }
+
+            void flush() {
+                out->write(reinterpret_cast<const char*>(buffer), static_cast<std::streamsize>(used));
+                bytesWritten += used;
+                used = 0;
+            }
+        };
+
+        // Reads a recording back one tick at a time through a fixed buffer
+        class InputPlayer {
+        public:
+            static constexpr std::size_t BUFFER_SIZE = 4096;
+
+        private:
+            std::istream* in;
+            unsigned char buffer[BUFFER_SIZE];
+            std::size_t position;
+            std::size_t available;
+
+            bool valid;
+            bool ended;
+            std::uint64_t seed;
+            float tickTime;
+
+            InputSnapshot current;
+            std::uint64_t remainingTicks;
+            std::uint64_t tickCount;
+
+        public:
+            explicit InputPlayer(std::istream& in)
+                : in(&in), position(0), available(0), valid(false), ended(true), seed(0),
+                  tickTime(0.0f), remainingTicks(0), tickCount(0) {
+                unsigned char header[Recording::HEADER_SIZE];
+                for (std::size_t i = 0; i < Recording::HEADER_SIZE; i++) {
+                    if (!getByte(header[i])) {
+                        return;
+                    }
+                }
+                if (std::memcmp(header, Recording::MAGIC, sizeof(Recording::MAGIC)) != 0 ||
+                    readFixed(header + 4, 4) != Recording::VERSION) {
+                    return;
+                }
+
+                seed = readFixed(header + 8, 8);
+                std::uint32_t tickBits = static_cast<std::uint32_t>(readFixed(header + 16, 4));
+                std::memcpy(&tickTime, &tickBits, sizeof(tickTime));
+                valid = true;
+                ended = false;
+            }
+
+            InputPlayer(const InputPlayer&) = delete;
+            InputPlayer& operator=(const InputPlayer&) = delete;
+
+            // False when the stream is not a recording this version can read
+            bool isValid() const {
+                return valid;
+            }
+
+            std::uint64_t getSeed() const {
+                return seed;
+            }
+
+            float getTickTime() const {
+                return tickTime;
+            }
+
+            // Ticks handed out so far
+            std::uint64_t getTickCount() const {
+                return tickCount;
+            }
+
+            // The snapshot of the next tick; false once the recording is exhausted
+            bool next(InputSnapshot& snapshot) {
+                if (remainingTicks == 0 && !readRecord()) {
+                    return false;
+                }
+                remainingTicks--;
+                tickCount++;
+                snapshot = current;
+                return true;
+            }
+
+        private:
+            bool readRecord() {
+                std::uint64_t ticks;
+                std::uint64_t mask;
+                if (ended || !getVarint(ticks) || ticks == 0 || !getVarint(mask)) {
+                    ended = true;
+                    return false;
+                }
+
+                // Decode into a copy so a truncated record leaves nothing half-applied
+                InputSnapshot next = current;
+                bool ok = true;
+                if (mask & Recording::HeldKeys) ok = ok && getBits(next.heldKeys);
+                if (mask & Recording::PressedKeys) ok = ok && getBits(next.pressedKeys);
+                if (mask & Recording::ReleasedKeys) ok = ok && getBits(next.releasedKeys);
+                if (mask & Recording::RepeatedKeys) ok = ok && getBits(next.repeatedKeys);
+                if (mask & Recording::HeldButtons) ok = ok && getBits(next.heldButtons);
+                if (mask & Recording::PressedButtons) ok = ok && getBits(next.pressedButtons);
+                if (mask & Recording::ReleasedButtons) ok = ok && getBits(next.releasedButtons);
+                if (mask & Recording::MouseX) ok = ok && getSigned(next.mouseX);
+                if (mask & Recording::MouseY) ok = ok && getSigned(next.mouseY);
+                if (!ok) {
+                    ended = true;
+                    return false;
+                }
+
+                current = next;
+                remainingTicks = ticks;
+                return true;
+            }
+
+            template <std::size_t BITS>
+            bool getBits(BitSet<BITS>& bits) {
+                for (std::size_t i = 0; i < BitSet<BITS>::WORDS; i++) {
+                    if (!getVarint(bits.words[i])) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            bool getSigned(std::int32_t& value) {
+                std::uint64_t raw;
+                if (!getVarint(raw)) {
+                    return false;
+                }
+                std::uint32_t bits = static_cast<std::uint32_t>(raw);
+                value = static_cast<std::int32_t>((bits >> 1) ^ (0u - (bits & 1u)));
+                return true;
+            }
+
+            bool getVarint(std::uint64_t& value) {
+                value = 0;
+                for (int shift = 0; shift < 64; shift += 7) {
+                    std::uint8_t byte;
+                    if (!getByte(byte)) {
+                        return false;
+                    }
+                    value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+                    if (!(byte & 0x80)) {
+                        return true;
+                    }
+                }
+                return false; // Over-long: not something InputRecorder writes
+            }
+
+            bool getByte(std::uint8_t& byte) {
+                if (position == available) {
+                    in->read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(BUFFER_SIZE));
+                    available = static_cast<std::size_t>(in->gcount());
+                    position = 0;
+                    if (available == 0) {
+                        return false;
+                    }
+                }
+                byte = buffer[position++];
+                return true;
+            }
+
+            static std::uint64_t readFixed(const unsigned char* bytes, int count) {
+                std::uint64_t value = 0;
+                for (int i = 0; i < count; i++) {
+                    value |= static_cast<std::uint64_t>(bytes[i]) << (8 * i);
+                }
+                return value;
+            }
+        };
+    }
+}
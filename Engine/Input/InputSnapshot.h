@@ -0,0 +1,204 @@
+#pragma once
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine {
+    namespace Input {
+        // Fixed-size bit set stored as 64-bit words, so tests are a shift and a mask and
+        // the words can be copied, compared or serialised as they are
+        template <std::size_t BITS>
+        class BitSet {
+        public:
+            static constexpr std::size_t WORDS = (BITS + 63) / 64;
+
+            std::uint64_t words[WORDS];
+
+            BitSet() {
+                clear();
+            }
+
+            bool test(std::size_t bit) const {
+                return bit < BITS && (words[bit / 64] >> (bit % 64)) & 1u;
+            }
+
+            void set(std::size_t bit, bool value = true) {
+                if (bit >= BITS) {
+                    return;
+                }
+                std::uint64_t mask = std::uint64_t(1) << (bit % 64);
+                words[bit / 64] = value ? (words[bit / 64] | mask) : (words[bit / 64] & ~mask);
+            }
+
+            void clear() {
+                for (std::size_t i = 0; i < WORDS; i++) {
+                    words[i] = 0;
+                }
+            }
+
+            bool any() const {
+                for (std::size_t i = 0; i < WORDS; i++) {
+                    if (words[i]) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            bool intersects(const BitSet& other) const {
+                for (std::size_t i = 0; i < WORDS; i++) {
+                    if (words[i] & other.words[i]) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            // Calls fn(bit) for every set bit, lowest first
+            template <typename Fn>
+            void forEach(Fn&& fn) const {
+                for (std::size_t i = 0; i < WORDS; i++) {
+                    std::uint64_t word = words[i];
+                    for (std::size_t bit = i * 64; word; bit++, word >>= 1) {
+                        if (word & 1u) {
+                            fn(bit);
+                        }
+                    }
+                }
+            }
+
+            BitSet operator&(const BitSet& other) const {
+                BitSet result;
+                for (std::size_t i = 0; i < WORDS; i++) {
+                    result.words[i] = words[i] & other.words[i];
+                }
+                return result;
+            }
+
+            BitSet operator|(const BitSet& other) const {
+                BitSet result;
+                for (std::size_t i = 0; i < WORDS; i++) {
+                    result.words[i] = words[i] | other.words[i];
+                }
+                return result;
+            }
+
+            // this & ~other
+            BitSet without(const BitSet& other) const {
+                BitSet result;
+                for (std::size_t i = 0; i < WORDS; i++) {
+                    result.words[i] = words[i] & ~other.words[i];
+                }
+                return result;
+            }
+
+            bool operator==(const BitSet& other) const {
+                for (std::size_t i = 0; i < WORDS; i++) {
+                    if (words[i] != other.words[i]) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            bool operator!=(const BitSet& other) const {
+                return !(*this == other);
+            }
+        };
+
+        using KeySet = BitSet<sf::Keyboard::KeyCount>;
+        using ButtonSet = BitSet<sf::Mouse::ButtonCount>;
+
+        // Keyboard and mouse input of one simulation tick: what is held, and what went
+        // down or up since the previous tick. A key tapped and released between two ticks
+        // shows up as pressed and released without being held. Keys the OS auto-repeats
+        // while held are reported as repeated, for menus that step on key repeat; gameplay
+        // should ignore them. A snapshot is plain data, so it can be stored, sent to another
+        // thread or read back from a recording.
+        struct InputSnapshot {
+            KeySet heldKeys;
+            KeySet pressedKeys;
+            KeySet releasedKeys;
+            KeySet repeatedKeys; // Held keys that got another KeyPressed (key repeat) this tick
+            ButtonSet heldButtons;
+            ButtonSet pressedButtons;
+            ButtonSet releasedButtons;
+            std::int32_t mouseX = 0;
+            std::int32_t mouseY = 0;
+
+            static std::size_t keyIndex(sf::Keyboard::Key key) {
+                // Unknown (-1) maps past the end and is ignored by BitSet
+                return static_cast<std::size_t>(static_cast<int>(key));
+            }
+
+            static std::size_t buttonIndex(sf::Mouse::Button button) {
+                return static_cast<std::size_t>(button);
+            }
+
+            bool isKeyDown(sf::Keyboard::Key key) const {
+                return heldKeys.test(keyIndex(key));
+            }
+
+            bool wasKeyPressed(sf::Keyboard::Key key) const {
+                return pressedKeys.test(keyIndex(key));
+            }
+
+            bool wasKeyReleased(sf::Keyboard::Key key) const {
+                return releasedKeys.test(keyIndex(key));
+            }
+
+            bool wasKeyRepeated(sf::Keyboard::Key key) const {
+                return repeatedKeys.test(keyIndex(key));
+            }
+
+            bool isButtonDown(sf::Mouse::Button button) const {
+                return heldButtons.test(buttonIndex(button));
+            }
+
+            bool wasButtonPressed(sf::Mouse::Button button) const {
+                return pressedButtons.test(buttonIndex(button));
+            }
+
+            bool wasButtonReleased(sf::Mouse::Button button) const {
+                return releasedButtons.test(buttonIndex(button));
+            }
+
+            sf::Vector2i getMousePosition() const {
+                return sf::Vector2i(mouseX, mouseY);
+            }
+
+            // Calls fn(sf::Keyboard::Key) for every key pressed this tick, in key code order.
+            // The snapshot keeps no arrival order, so two keys pressed within one tick (e.g.
+            // Down then Enter in a menu) are handled in code order, not the order they were
+            // typed. Live play and its replay see the same order, so replays stay exact.
+            template <typename Fn>
+            void forEachPressedKey(Fn&& fn) const {
+                pressedKeys.forEach([&fn](std::size_t bit) {
+                    fn(static_cast<sf::Keyboard::Key>(bit));
+                });
+            }
+
+            // Like forEachPressedKey, plus the keys auto-repeated this tick, so a held arrow
+            // keeps stepping through a menu. Each key is reported at most once per tick.
+            template <typename Fn>
+            void forEachPressedOrRepeatedKey(Fn&& fn) const {
+                (pressedKeys | repeatedKeys).forEach([&fn](std::size_t bit) {
+                    fn(static_cast<sf::Keyboard::Key>(bit));
+                });
+            }
+
+            bool operator==(const InputSnapshot& other) const {
+                return heldKeys == other.heldKeys && pressedKeys == other.pressedKeys &&
+                       releasedKeys == other.releasedKeys && repeatedKeys == other.repeatedKeys &&
+                       heldButtons == other.heldButtons &&
+                       pressedButtons == other.pressedButtons && releasedButtons == other.releasedButtons &&
+                       mouseX == other.mouseX && mouseY == other.mouseY;
+            }
+
+            bool operator!=(const InputSnapshot& other) const {
+                return !(*this == other);
+            }
+        };
+    }
+}
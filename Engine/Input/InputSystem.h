@@ -0,0 +1,203 @@
+#pragma once
+#include "InputSnapshot.h"
+#include <SFML/Window/Event.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Engine {
+    namespace Input {
+        // Index of a named action; resolve names once with bindAction/findAction and query by id
+        using ActionId = std::size_t;
+
+        // Turns the window's event stream into one InputSnapshot per simulation tick.
+        // Events update a live key state as they arrive; beginTick() publishes it together
+        // with the edges since the previous tick, so every query afterwards is a bit test
+        // instead of an OS call. Gameplay should read the snapshot only, which makes a
+        // recorded snapshot (setSnapshot) indistinguishable from live input.
+        // Not thread-safe: feed events on the thread that runs the simulation.
+        class InputSystem {
+        public:
+            static constexpr ActionId NO_ACTION = static_cast<ActionId>(-1);
+
+        private:
+            struct Action {
+                std::string name;
+                KeySet keys;
+                ButtonSet buttons;
+            };
+
+            // Built from events between ticks
+            KeySet liveKeys;
+            ButtonSet liveButtons;
+            KeySet keysDown;   // Went down since the last tick, even if already up again
+            KeySet keysUp;
+            KeySet keysRepeated; // KeyPressed for a key already down: the OS's key repeat
+            ButtonSet buttonsDown;
+            ButtonSet buttonsUp;
+            std::int32_t liveMouseX;
+            std::int32_t liveMouseY;
+
+            InputSnapshot snapshot;
+            std::vector<Action> actions;
+
+        public:
+            InputSystem() : liveMouseX(0), liveMouseY(0) {}
+
+            void handleEvent(const sf::Event& event) {
+                if (const auto* key = event.getIf<sf::Event::KeyPressed>()) {
+                    std::size_t index = InputSnapshot::keyIndex(key->code);
+                    // Key repeat sends KeyPressed again while held; that is not a new press
+                    if (liveKeys.test(index)) {
+                        keysRepeated.set(index);
+                    } else {
+                        keysDown.set(index);
+                    }
+                    liveKeys.set(index);
+                } else if (const auto* key = event.getIf<sf::Event::KeyReleased>()) {
+                    std::size_t index = InputSnapshot::keyIndex(key->code);
+                    if (liveKeys.test(index)) {
+                        keysUp.set(index);
+                    }
+                    liveKeys.set(index, false);
+                } else if (const auto* button = event.getIf<sf::Event::MouseButtonPressed>()) {
+                    std::size_t index = InputSnapshot::buttonIndex(button->button);
+                    buttonsDown.set(index);
+                    liveButtons.set(index);
+                    liveMouseX = button->position.x;
+                    liveMouseY = button->position.y;
+                } else if (const auto* button = event.getIf<sf::Event::MouseButtonReleased>()) {
+                    std::size_t index = InputSnapshot::buttonIndex(button->button);
+                    buttonsUp.set(index);
+                    liveButtons.set(index, false);
+                    liveMouseX = button->position.x;
+                    liveMouseY = button->position.y;
+                } else if (const auto* moved = event.getIf<sf::Event::MouseMoved>()) {
+                    liveMouseX = moved->position.x;
+                    liveMouseY = moved->position.y;
+                } else if (event.is<sf::Event::FocusLost>()) {
+                    // Releases arriving while unfocused are lost, so let go of everything now
+                    keysUp = keysUp | liveKeys;
+                    buttonsUp = buttonsUp | liveButtons;
+                    liveKeys.clear();
+                    liveButtons.clear();
+                }
+            }
+
+            // Publishes the input gathered since the last call as this tick's snapshot
+            void beginTick() {
+                const KeySet previousKeys = snapshot.heldKeys;
+                const ButtonSet previousButtons = snapshot.heldButtons;
+
+                snapshot.heldKeys = liveKeys;
+                snapshot.pressedKeys = keysDown | liveKeys.without(previousKeys);
+                snapshot.releasedKeys = keysUp | previousKeys.without(liveKeys);
+                snapshot.repeatedKeys = keysRepeated;
+                snapshot.heldButtons = liveButtons;
+                snapshot.pressedButtons = buttonsDown | liveButtons.without(previousButtons);
+                snapshot.releasedButtons = buttonsUp | previousButtons.without(liveButtons);
+                snapshot.mouseX = liveMouseX;
+                snapshot.mouseY = liveMouseY;
+
+                keysDown.clear();
+                keysUp.clear();
+                keysRepeated.clear();
+                buttonsDown.clear();
+                buttonsUp.clear();
+            }
+
+            // Replaces this tick's snapshot, e.g. with one read back from a recording
+            void setSnapshot(const InputSnapshot& recorded) {
+                snapshot = recorded;
+            }
+
+            // Forgets held keys and pending edges, e.g. when switching between live and replayed input
+            void reset() {
+                liveKeys.clear();
+                liveButtons.clear();
+                keysDown.clear();
+                keysUp.clear();
+                keysRepeated.clear();
+                buttonsDown.clear();
+                buttonsUp.clear();
+                snapshot = InputSnapshot();
+            }
+
+            const InputSnapshot& getSnapshot() const {
+                return snapshot;
+            }
+
+            // Adds a key to the named action, creating the action on first use
+            ActionId bindAction(const std::string& name, sf::Keyboard::Key key) {
+                ActionId id = findOrAddAction(name);
+                actions[id].keys.set(InputSnapshot::keyIndex(key));
+                return id;
+            }
+
+            ActionId bindAction(const std::string& name, sf::Mouse::Button button) {
+                ActionId id = findOrAddAction(name);
+                actions[id].buttons.set(InputSnapshot::buttonIndex(button));
+                return id;
+            }
+
+            // Removes every key and button from the action; the id stays valid
+            void clearBindings(ActionId id) {
+                actions[id].keys.clear();
+                actions[id].buttons.clear();
+            }
+
+            // NO_ACTION when nothing has that name
+            ActionId findAction(const std::string& name) const {
+                for (std::size_t i = 0; i < actions.size(); i++) {
+                    if (actions[i].name == name) {
+                        return i;
+                    }
+                }
+                return NO_ACTION;
+            }
+
+            const std::string& getActionName(ActionId id) const {
+                return actions[id].name;
+            }
+
+            // Any bound key or button is held
+            bool isActionDown(ActionId id) const {
+                const Action& action = actions[id];
+                return snapshot.heldKeys.intersects(action.keys) || snapshot.heldButtons.intersects(action.buttons);
+            }
+
+            // Any bound key or button went down this tick
+            bool wasActionPressed(ActionId id) const {
+                const Action& action = actions[id];
+                return snapshot.pressedKeys.intersects(action.keys) || snapshot.pressedButtons.intersects(action.buttons);
+            }
+
+            bool wasActionReleased(ActionId id) const {
+                const Action& action = actions[id];
+                return snapshot.releasedKeys.intersects(action.keys) || snapshot.releasedButtons.intersects(action.buttons);
+            }
+
+            bool isKeyDown(sf::Keyboard::Key key) const {
+                return snapshot.isKeyDown(key);
+            }
+
+            bool wasKeyPressed(sf::Keyboard::Key key) const {
+                return snapshot.wasKeyPressed(key);
+            }
+
+            bool wasKeyReleased(sf::Keyboard::Key key) const {
+                return snapshot.wasKeyReleased(key);
+            }
+
+        private:
+            ActionId findOrAddAction(const std::string& name) {
+                ActionId id = findAction(name);
+                if (id == NO_ACTION) {
+                    id = actions.size();
+                    actions.push_back({name, KeySet(), ButtonSet()});
+                }
+                return id;
+            }
+        };
+    }
+}
@@ -0,0 +1,142 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+
+namespace Engine {
+    namespace Math {
+        // PCG32 (XSH-RR): 64-bit state, 32-bit output, period 2^64 per stream and 2^63
+        // selectable streams. Each object owns its generator, so simulations seeded the
+        // same way replay the same numbers regardless of what else runs in the process.
+        // Also a standard UniformRandomBitGenerator, for use with <random> and std::shuffle.
+        class Random {
+        private:
+            static constexpr std::uint64_t MULTIPLIER = 6364136223846793005ull;
+
+            std::uint64_t state;
+            std::uint64_t increment; // Always odd; selects the stream
+            std::uint64_t seed;      // As passed to reseed(), for stream()
+
+        public:
+            using result_type = std::uint32_t;
+
+            static constexpr std::uint64_t DEFAULT_SEED = 0x853c49e6748fea9bull;
+
+            explicit Random(std::uint64_t seed = DEFAULT_SEED, std::uint64_t stream = 0) {
+                reseed(seed, stream);
+            }
+
+            void reseed(std::uint64_t newSeed, std::uint64_t stream = 0) {
+                seed = newSeed;
+                state = 0;
+                increment = (stream << 1) | 1u;
+                next();
+                state += newSeed;
+                next();
+            }
+
+            std::uint32_t next() {
+                std::uint64_t old = state;
+                state = old * MULTIPLIER + increment;
+                std::uint32_t xorShifted = static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27);
+                std::uint32_t rotation = static_cast<std::uint32_t>(old >> 59);
+                return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31));
+            }
+
+            std::uint64_t next64() {
+                std::uint64_t high = next();
+                return (high << 32) | next();
+            }
+
+            // Unbiased integer in [0, bound) (Lemire's multiply-shift with rejection); bound > 0
+            std::uint32_t nextBelow(std::uint32_t bound) {
+                std::uint64_t product = static_cast<std::uint64_t>(next()) * bound;
+                std::uint32_t low = static_cast<std::uint32_t>(product);
+                if (low < bound) {
+                    std::uint32_t threshold = (0u - bound) % bound;
+                    while (low < threshold) {
+                        product = static_cast<std::uint64_t>(next()) * bound;
+                        low = static_cast<std::uint32_t>(product);
+                    }
+                }
+                return static_cast<std::uint32_t>(product >> 32);
+            }
+
+            // Integer in [min, max], both inclusive
+            int range(int min, int max) {
+                std::uint32_t span = static_cast<std::uint32_t>(max) - static_cast<std::uint32_t>(min) + 1u;
+                if (span == 0) {
+                    return static_cast<int>(next()); // The full 32-bit range
+                }
+                return static_cast<int>(static_cast<std::uint32_t>(min) + nextBelow(span));
+            }
+
+            // Uniform in [0, 1), from the top 24 bits
+            float nextFloat() {
+                return (next() >> 8) * (1.0f / 16777216.0f);
+            }
+
+            // Uniform in [0, 1), from 53 bits
+            double nextDouble() {
+                return (next64() >> 11) * (1.0 / 9007199254740992.0);
+            }
+
+            // Uniform in [min, max)
+            float range(float min, float max) {
+                return min + (max - min) * nextFloat();
+            }
+
+            bool nextBool() {
+                return (next() >> 31) != 0;
+            }
+
+            // A new, statistically independent generator (its own seed and stream), e.g. one
+            // per job or per spawned object. Deterministic: the parent's sequence decides it.
+            Random split() {
+                std::uint64_t seed = next64();
+                std::uint64_t stream = next64();
+                return Random(seed, stream);
+            }
+
+            // Generator `index` of the family sharing this one's seed, freshly seeded on
+            // its own stream; it does not depend on how many numbers this one has drawn
+            Random stream(std::uint64_t index) const {
+                return Random(seed, index);
+            }
+
+            std::uint64_t getSeed() const {
+                return seed;
+            }
+
+            // Skips delta outputs in O(log delta) steps, e.g. to give each job its own slice
+            void advance(std::uint64_t delta) {
+                std::uint64_t multiplier = MULTIPLIER;
+                std::uint64_t addend = increment;
+                std::uint64_t accumulatedMultiplier = 1;
+                std::uint64_t accumulatedAddend = 0;
+                while (delta > 0) {
+                    if (delta & 1) {
+                        accumulatedMultiplier *= multiplier;
+                        accumulatedAddend = accumulatedAddend * multiplier + addend;
+                    }
+                    addend = (multiplier + 1) * addend;
+                    multiplier *= multiplier;
+                    delta >>= 1;
+                }
+                state = accumulatedMultiplier * state + accumulatedAddend;
+            }
+
+            // UniformRandomBitGenerator interface
+            static constexpr result_type min() {
+                return 0;
+            }
+
+            static constexpr result_type max() {
+                return std::numeric_limits<result_type>::max();
+            }
+
+            result_type operator()() {
+                return next();
+            }
+        };
+    }
+}
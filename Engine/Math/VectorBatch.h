@@ -0,0 +1,309 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define ENGINE_SIMD_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        // MSVC allows AVX2 intrinsics in any function; dispatch keeps them off older CPUs
+        #define ENGINE_TARGET_AVX2
+    #else
+        #define ENGINE_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#else
+    #define ENGINE_SIMD_X86 0
+#endif
+
+namespace Engine {
+    namespace Math {
+        enum class SimdLevel {
+            Scalar,
+            SSE2,
+            AVX2
+        };
+
+        // Batch kernels over float arrays. Vectors are either structure-of-arrays
+        // (separate xs / ys) or interleaved x,y pairs, such as an array of Vector2 or
+        // ECS::Position. The widest instruction set the CPU supports is picked at
+        // runtime, with a scalar fallback. Results match the scalar Vector2 operators:
+        // only IEEE-exact add, mul, div and sqrt are used, no approximations.
+        class VectorBatch {
+        private:
+            static SimdLevel& activeLevel() {
+                static SimdLevel level = detectSimdLevel();
+                return level;
+            }
+
+        public:
+            static SimdLevel detectSimdLevel() {
+#if ENGINE_SIMD_X86
+    #if defined(_MSC_VER)
+                int info[4];
+                __cpuid(info, 0);
+                if (info[0] >= 7) {
+                    __cpuid(info, 1);
+                    bool osxsave = (info[2] & (1 << 27)) != 0;
+                    bool avx = (info[2] & (1 << 28)) != 0;
+                    // The OS must save the YMM registers on context switch
+                    bool ymmEnabled = osxsave && (_xgetbv(0) & 0x6) == 0x6;
+                    __cpuidex(info, 7, 0);
+                    bool avx2 = (info[1] & (1 << 5)) != 0;
+                    if (avx && ymmEnabled && avx2) {
+                        return SimdLevel::AVX2;
+                    }
+                }
+                return SimdLevel::SSE2;
+    #else
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2")) {
+                    return SimdLevel::AVX2;
+                }
+                return SimdLevel::SSE2;
+    #endif
+#else
+                return SimdLevel::Scalar;
+#endif
+            }
+
+            static SimdLevel getSimdLevel() {
+                return activeLevel();
+            }
+
+            // Forces a lower level, e.g. to compare paths; requests above what the CPU supports are clamped
+            static void setSimdLevel(SimdLevel level) {
+                activeLevel() = std::min(level, detectSimdLevel());
+            }
+
+            // position += velocity * dt, structure-of-arrays
+            static void integrate(float* xs, float* ys, const float* velocityXs, const float* velocityYs,
+                                  std::size_t count, float deltaTime) {
+                multiplyAdd(xs, velocityXs, deltaTime, count);
+                multiplyAdd(ys, velocityYs, deltaTime, count);
+            }
+
+            // position += velocity * dt, interleaved x,y pairs
+            static void integrateInterleaved(float* positions, const float* velocities,
+                                             std::size_t count, float deltaTime) {
+                multiplyAdd(positions, velocities, deltaTime, count * 2);
+            }
+
+            static void scale(float* xs, float* ys, std::size_t count, float scalar) {
+                multiply(xs, scalar, count);
+                multiply(ys, scalar, count);
+            }
+
+            static void scaleInterleaved(float* vectors, std::size_t count, float scalar) {
+                multiply(vectors, scalar, count * 2);
+            }
+
+            // out[i] = |(xs[i], ys[i])|
+            static void length(const float* xs, const float* ys, float* out, std::size_t count) {
+                std::size_t i = 0;
+#if ENGINE_SIMD_X86
+                if (getSimdLevel() == SimdLevel::AVX2) {
+                    i = lengthAVX2(xs, ys, out, count);
+                } else if (getSimdLevel() == SimdLevel::SSE2) {
+                    i = lengthSSE2(xs, ys, out, count);
+                }
+#endif
+                for (; i < count; i++) {
+                    out[i] = std::sqrt(xs[i] * xs[i] + ys[i] * ys[i]);
+                }
+            }
+
+            // Normalizes in place; zero-length vectors become (0, 0) like Vector2::normalized
+            static void normalize(float* xs, float* ys, std::size_t count) {
+                std::size_t i = 0;
+#if ENGINE_SIMD_X86
+                if (getSimdLevel() == SimdLevel::AVX2) {
+                    i = normalizeAVX2(xs, ys, count);
+                } else if (getSimdLevel() == SimdLevel::SSE2) {
+                    i = normalizeSSE2(xs, ys, count);
+                }
+#endif
+                for (; i < count; i++) {
+                    float mag = std::sqrt(xs[i] * xs[i] + ys[i] * ys[i]);
+                    if (mag > 0.0f) {
+                        xs[i] = xs[i] / mag;
+                        ys[i] = ys[i] / mag;
+                    } else {
+                        xs[i] = 0.0f;
+                        ys[i] = 0.0f;
+                    }
+                }
+            }
+
+            static void clampToBounds(float* xs, float* ys, std::size_t count,
+                                      float minX, float minY, float maxX, float maxY) {
+                clamp(xs, minX, maxX, count);
+                clamp(ys, minY, maxY, count);
+            }
+
+        private:
+            // dst[i] += src[i] * scalar
+            static void multiplyAdd(float* dst, const float* src, float scalar, std::size_t count) {
+                std::size_t i = 0;
+#if ENGINE_SIMD_X86
+                if (getSimdLevel() == SimdLevel::AVX2) {
+                    i = multiplyAddAVX2(dst, src, scalar, count);
+                } else if (getSimdLevel() == SimdLevel::SSE2) {
+                    i = multiplyAddSSE2(dst, src, scalar, count);
+                }
+#endif
+                for (; i < count; i++) {
+                    dst[i] += src[i] * scalar;
+                }
+            }
+
+            static void multiply(float* dst, float scalar, std::size_t count) {
+                std::size_t i = 0;
+#if ENGINE_SIMD_X86
+                if (getSimdLevel() == SimdLevel::AVX2) {
+                    i = multiplyAVX2(dst, scalar, count);
+                } else if (getSimdLevel() == SimdLevel::SSE2) {
+                    i = multiplySSE2(dst, scalar, count);
+                }
+#endif
+                for (; i < count; i++) {
+                    dst[i] *= scalar;
+                }
+            }
+
+            static void clamp(float* dst, float low, float high, std::size_t count) {
+                std::size_t i = 0;
+#if ENGINE_SIMD_X86
+                if (getSimdLevel() == SimdLevel::AVX2) {
+                    i = clampAVX2(dst, low, high, count);
+                } else if (getSimdLevel() == SimdLevel::SSE2) {
+                    i = clampSSE2(dst, low, high, count);
+                }
+#endif
+                for (; i < count; i++) {
+                    dst[i] = std::min(std::max(dst[i], low), high);
+                }
+            }
+
+#if ENGINE_SIMD_X86
+            // Each SIMD kernel processes whole registers and returns how many elements
+            // it handled; the scalar loop in the caller finishes the remainder.
+            // Multiply and add stay separate (no FMA) so rounding matches the scalar path.
+            // min/max return their second operand when either is NaN, so the value being
+            // clamped goes second: a NaN passes through, as with std::min(std::max(x, lo), hi).
+
+            static std::size_t multiplyAddSSE2(float* dst, const float* src, float scalar, std::size_t count) {
+                __m128 s = _mm_set1_ps(scalar);
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    __m128 d = _mm_loadu_ps(dst + i);
+                    _mm_storeu_ps(dst + i, _mm_add_ps(d, _mm_mul_ps(_mm_loadu_ps(src + i), s)));
+                }
+                return i;
+            }
+
+            ENGINE_TARGET_AVX2
+            static std::size_t multiplyAddAVX2(float* dst, const float* src, float scalar, std::size_t count) {
+                __m256 s = _mm256_set1_ps(scalar);
+                std::size_t i = 0;
+                for (; i + 8 <= count; i += 8) {
+                    __m256 d = _mm256_loadu_ps(dst + i);
+                    _mm256_storeu_ps(dst + i, _mm256_add_ps(d, _mm256_mul_ps(_mm256_loadu_ps(src + i), s)));
+                }
+                return i;
+            }
+
+            static std::size_t multiplySSE2(float* dst, float scalar, std::size_t count) {
+                __m128 s = _mm_set1_ps(scalar);
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_loadu_ps(dst + i), s));
+                }
+                return i;
+            }
+
+            ENGINE_TARGET_AVX2
+            static std::size_t multiplyAVX2(float* dst, float scalar, std::size_t count) {
+                __m256 s = _mm256_set1_ps(scalar);
+                std::size_t i = 0;
+                for (; i + 8 <= count; i += 8) {
+                    _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_loadu_ps(dst + i), s));
+                }
+                return i;
+            }
+
+            static std::size_t clampSSE2(float* dst, float low, float high, std::size_t count) {
+                __m128 lo = _mm_set1_ps(low);
+                __m128 hi = _mm_set1_ps(high);
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    _mm_storeu_ps(dst + i, _mm_min_ps(hi, _mm_max_ps(lo, _mm_loadu_ps(dst + i))));
+                }
+                return i;
+            }
+
+            ENGINE_TARGET_AVX2
+            static std::size_t clampAVX2(float* dst, float low, float high, std::size_t count) {
+                __m256 lo = _mm256_set1_ps(low);
+                __m256 hi = _mm256_set1_ps(high);
+                std::size_t i = 0;
+                for (; i + 8 <= count; i += 8) {
+                    _mm256_storeu_ps(dst + i, _mm256_min_ps(hi, _mm256_max_ps(lo, _mm256_loadu_ps(dst + i))));
+                }
+                return i;
+            }
+
+            static std::size_t lengthSSE2(const float* xs, const float* ys, float* out, std::size_t count) {
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    __m128 x = _mm_loadu_ps(xs + i);
+                    __m128 y = _mm_loadu_ps(ys + i);
+                    _mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y))));
+                }
+                return i;
+            }
+
+            ENGINE_TARGET_AVX2
+            static std::size_t lengthAVX2(const float* xs, const float* ys, float* out, std::size_t count) {
+                std::size_t i = 0;
+                for (; i + 8 <= count; i += 8) {
+                    __m256 x = _mm256_loadu_ps(xs + i);
+                    __m256 y = _mm256_loadu_ps(ys + i);
+                    _mm256_storeu_ps(out + i, _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y))));
+                }
+                return i;
+            }
+
+            static std::size_t normalizeSSE2(float* xs, float* ys, std::size_t count) {
+                __m128 zero = _mm_setzero_ps();
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    __m128 x = _mm_loadu_ps(xs + i);
+                    __m128 y = _mm_loadu_ps(ys + i);
+                    __m128 mag = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+                    __m128 nonZero = _mm_cmpgt_ps(mag, zero);
+                    _mm_storeu_ps(xs + i, _mm_and_ps(_mm_div_ps(x, mag), nonZero));
+                    _mm_storeu_ps(ys + i, _mm_and_ps(_mm_div_ps(y, mag), nonZero));
+                }
+                return i;
+            }
+
+            ENGINE_TARGET_AVX2
+            static std::size_t normalizeAVX2(float* xs, float* ys, std::size_t count) {
+                __m256 zero = _mm256_setzero_ps();
+                std::size_t i = 0;
+                for (; i + 8 <= count; i += 8) {
+                    __m256 x = _mm256_loadu_ps(xs + i);
+                    __m256 y = _mm256_loadu_ps(ys + i);
+                    __m256 mag = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)));
+                    __m256 nonZero = _mm256_cmp_ps(mag, zero, _CMP_GT_OQ);
+                    _mm256_storeu_ps(xs + i, _mm256_and_ps(_mm256_div_ps(x, mag), nonZero));
+                    _mm256_storeu_ps(ys + i, _mm256_and_ps(_mm256_div_ps(y, mag), nonZero));
+                }
+                return i;
+            }
+#endif
+        };
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+namespace Engine {
+    namespace Physics {
+        struct AABB {
+            float minX, minY, maxX, maxY;
+
+            static AABB fromCircle(float centerX, float centerY, float radius) {
+                return {centerX - radius, centerY - radius, centerX + radius, centerY + radius};
+            }
+
+            static AABB fromRect(float x, float y, float width, float height) {
+                return {x, y, x + width, y + height};
+            }
+
+            // Strict overlap: touching edges do not count, same as sf::FloatRect::findIntersection
+            bool overlaps(const AABB& other) const {
+                return minX < other.maxX && other.minX < maxX &&
+                       minY < other.maxY && other.minY < maxY;
+            }
+        };
+    }
+}
@@ -0,0 +1,233 @@
+#pragma once
+#include "AABB.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+    namespace Physics {
+        struct ProxyPair {
+            std::uint32_t a; // Always the smaller proxy id
+            std::uint32_t b;
+        };
+
+        // Uniform-grid broadphase stored in a fixed-size spatial hash. Proxies are
+        // inserted into every cell their AABB touches; moving a proxy within the same
+        // cells is O(1). Buckets and the pair buffer keep their capacity, so steady-state
+        // insert/move/remove and findPairs do not allocate.
+        class SpatialHash {
+        public:
+            static constexpr std::uint32_t INVALID_PROXY = 0xFFFFFFFFu;
+
+        private:
+            struct CellRange {
+                int minX, minY, maxX, maxY;
+
+                bool operator==(const CellRange& other) const {
+                    return minX == other.minX && minY == other.minY && maxX == other.maxX && maxY == other.maxY;
+                }
+            };
+
+            struct Proxy {
+                AABB bounds;
+                CellRange cells;
+                std::uint32_t userData;
+                bool alive;
+            };
+
+            // The cell is stored with the proxy so hash collisions between cells never mix
+            struct BucketEntry {
+                std::uint32_t proxy;
+                int cellX;
+                int cellY;
+            };
+
+            float cellSize;
+            float inverseCellSize;
+            std::size_t bucketMask;
+            std::vector<std::vector<BucketEntry>> buckets;
+            std::vector<Proxy> proxies;
+            std::vector<std::uint32_t> freeProxies;
+            std::vector<ProxyPair> pairs;
+            std::size_t proxyCount;
+
+        public:
+            // bucketCount is rounded up to a power of two; aim for roughly one bucket per occupied cell
+            explicit SpatialHash(float cellSize, std::size_t bucketCount = 4096)
+                : cellSize(cellSize), inverseCellSize(1.0f / cellSize), proxyCount(0) {
+                std::size_t count = 1;
+                while (count < bucketCount) {
+                    count <<= 1;
+                }
+                bucketMask = count - 1;
+                buckets.resize(count);
+            }
+
+            std::uint32_t insert(const AABB& bounds, std::uint32_t userData = 0) {
+                std::uint32_t id;
+                if (!freeProxies.empty()) {
+                    id = freeProxies.back();
+                    freeProxies.pop_back();
+                } else {
+                    id = static_cast<std::uint32_t>(proxies.size());
+                    proxies.push_back({});
+                }
+
+                Proxy& proxy = proxies[id];
+                proxy.bounds = bounds;
+                proxy.cells = cellRange(bounds);
+                proxy.userData = userData;
+                proxy.alive = true;
+                addToCells(id, proxy.cells);
+
+                proxyCount++;
+                return id;
+            }
+
+            // Ignored for a removed proxy, whose id may be waiting on the free list
+            void move(std::uint32_t id, const AABB& bounds) {
+                Proxy& proxy = proxies[id];
+                if (!proxy.alive) {
+                    return;
+                }
+
+                proxy.bounds = bounds;
+
+                CellRange cells = cellRange(bounds);
+                if (cells == proxy.cells) {
+                    return;
+                }
+
+                removeFromCells(id, proxy.cells);
+                proxy.cells = cells;
+                addToCells(id, cells);
+            }
+
+            void remove(std::uint32_t id) {
+                Proxy& proxy = proxies[id];
+                if (!proxy.alive) {
+                    return;
+                }
+
+                removeFromCells(id, proxy.cells);
+                proxy.alive = false;
+                freeProxies.push_back(id);
+                proxyCount--;
+            }
+
+            const AABB& getBounds(std::uint32_t id) const {
+                return proxies[id].bounds;
+            }
+
+            std::uint32_t getUserData(std::uint32_t id) const {
+                return proxies[id].userData;
+            }
+
+            std::size_t getProxyCount() const {
+                return proxyCount;
+            }
+
+            // Every overlapping pair exactly once. Buckets are walked in order and only
+            // entries of the same cell are paired. A pair is reported only from the cell
+            // holding the top-left corner of the two boxes' intersection, so proxies
+            // sharing several cells are not duplicated.
+            const std::vector<ProxyPair>& findPairs() {
+                pairs.clear();
+
+                for (const std::vector<BucketEntry>& bucket : buckets) {
+                    for (std::size_t i = 0; i + 1 < bucket.size(); i++) {
+                        const BucketEntry& first = bucket[i];
+                        const AABB& firstBounds = proxies[first.proxy].bounds;
+
+                        for (std::size_t j = i + 1; j < bucket.size(); j++) {
+                            const BucketEntry& second = bucket[j];
+                            if (second.cellX != first.cellX || second.cellY != first.cellY) {
+                                continue;
+                            }
+
+                            const AABB& secondBounds = proxies[second.proxy].bounds;
+                            if (!firstBounds.overlaps(secondBounds)) {
+                                continue;
+                            }
+
+                            int ownerX = cellCoordinate(std::max(firstBounds.minX, secondBounds.minX));
+                            int ownerY = cellCoordinate(std::max(firstBounds.minY, secondBounds.minY));
+                            if (ownerX == first.cellX && ownerY == first.cellY) {
+                                pairs.push_back({std::min(first.proxy, second.proxy),
+                                                 std::max(first.proxy, second.proxy)});
+                            }
+                        }
+                    }
+                }
+
+                return pairs;
+            }
+
+            // Appends the ids of every proxy overlapping bounds to out (each once)
+            void query(const AABB& bounds, std::vector<std::uint32_t>& out) const {
+                CellRange range = cellRange(bounds);
+                for (int cellY = range.minY; cellY <= range.maxY; cellY++) {
+                    for (int cellX = range.minX; cellX <= range.maxX; cellX++) {
+                        for (const BucketEntry& entry : buckets[bucketIndex(cellX, cellY)]) {
+                            if (entry.cellX != cellX || entry.cellY != cellY) {
+                                continue;
+                            }
+
+                            const AABB& other = proxies[entry.proxy].bounds;
+                            if (!bounds.overlaps(other)) {
+                                continue;
+                            }
+
+                            // Report from the first cell both ranges share
+                            const CellRange& cells = proxies[entry.proxy].cells;
+                            if (cellX == std::max(range.minX, cells.minX) && cellY == std::max(range.minY, cells.minY)) {
+                                out.push_back(entry.proxy);
+                            }
+                        }
+                    }
+                }
+            }
+
+        private:
+            int cellCoordinate(float value) const {
+                return static_cast<int>(std::floor(value * inverseCellSize));
+            }
+
+            CellRange cellRange(const AABB& bounds) const {
+                return {cellCoordinate(bounds.minX), cellCoordinate(bounds.minY),
+                        cellCoordinate(bounds.maxX), cellCoordinate(bounds.maxY)};
+            }
+
+            std::size_t bucketIndex(int cellX, int cellY) const {
+                std::uint32_t hash = static_cast<std::uint32_t>(cellX) * 73856093u ^
+                                     static_cast<std::uint32_t>(cellY) * 19349663u;
+                return hash & bucketMask;
+            }
+
+            void addToCells(std::uint32_t id, const CellRange& cells) {
+                for (int cellY = cells.minY; cellY <= cells.maxY; cellY++) {
+                    for (int cellX = cells.minX; cellX <= cells.maxX; cellX++) {
+                        buckets[bucketIndex(cellX, cellY)].push_back({id, cellX, cellY});
+                    }
+                }
+            }
+
+            void removeFromCells(std::uint32_t id, const CellRange& cells) {
+                for (int cellY = cells.minY; cellY <= cells.maxY; cellY++) {
+                    for (int cellX = cells.minX; cellX <= cells.maxX; cellX++) {
+                        std::vector<BucketEntry>& bucket = buckets[bucketIndex(cellX, cellY)];
+                        for (std::size_t i = 0; i < bucket.size(); i++) {
+                            if (bucket[i].proxy == id && bucket[i].cellX == cellX && bucket[i].cellY == cellY) {
+                                bucket[i] = bucket.back();
+                                bucket.pop_back();
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+        };
+    }
+}
@@ -0,0 +1,155 @@
+#pragma once
+#include "AABB.h"
+#include "../Math/Vector2.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Engine {
+    namespace Physics {
+        // Result of a swept query. time is the fraction (0..1) of the displacement at
+        // which the shapes first touch; normal points from the obstacle toward the circle.
+        struct SweepHit {
+            bool hit;
+            float time;
+            Math::Vector2 normal;
+
+            static SweepHit none() {
+                return {false, 1.0f, Math::Vector2(0.0f, 0.0f)};
+            }
+        };
+
+        // Continuous (swept) collision queries for a circle moving in a straight line.
+        // Only approaching contacts are reported: a circle already touching an obstacle
+        // and moving away from it is free to leave.
+        class Sweep {
+        public:
+            // Plane: dot(normal, p) == offset, with the circle on the side the normal points to
+            static SweepHit circleVsPlane(const Math::Vector2& center, float radius, const Math::Vector2& displacement,
+                                          const Math::Vector2& normal, float offset) {
+                float approach = dot(normal, displacement);
+                if (approach >= 0.0f) {
+                    return SweepHit::none();
+                }
+
+                float distance = dot(normal, center) - offset - radius;
+                if (distance <= 0.0f) {
+                    return {true, 0.0f, normal};
+                }
+
+                float time = distance / -approach;
+                if (time > 1.0f) {
+                    return SweepHit::none();
+                }
+                return {true, time, normal};
+            }
+
+            // Ray against the box grown by the radius, with the corners of the grown box
+            // rounded: face hits come from a slab test, corner hits from a ray-circle test.
+            static SweepHit circleVsAABB(const Math::Vector2& center, float radius, const Math::Vector2& displacement,
+                                         const AABB& box) {
+                // Already touching: report an immediate contact if moving further in
+                Math::Vector2 closest(std::clamp(center.x, box.minX, box.maxX), std::clamp(center.y, box.minY, box.maxY));
+                Math::Vector2 offset = center - closest;
+                float distanceSquared = dot(offset, offset);
+                if (distanceSquared <= radius * radius) {
+                    Math::Vector2 normal = distanceSquared > 0.0f ? offset.normalized() : insideNormal(center, box);
+                    if (dot(normal, displacement) >= 0.0f) {
+                        return SweepHit::none();
+                    }
+                    return {true, 0.0f, normal};
+                }
+
+                // Slab test against the grown box
+                float entry = 0.0f;
+                float exit = 1.0f;
+                Math::Vector2 normal(0.0f, 0.0f);
+                if (!clipSlab(center.x, displacement.x, box.minX - radius, box.maxX + radius,
+                              Math::Vector2(1.0f, 0.0f), entry, exit, normal) ||
+                    !clipSlab(center.y, displacement.y, box.minY - radius, box.maxY + radius,
+                              Math::Vector2(0.0f, 1.0f), entry, exit, normal)) {
+                    return SweepHit::none();
+                }
+
+                Math::Vector2 point = center + displacement * entry;
+                bool beyondX = point.x < box.minX || point.x > box.maxX;
+                bool beyondY = point.y < box.minY || point.y > box.maxY;
+                if (!(beyondX && beyondY)) {
+                    return {true, entry, normal};
+                }
+
+                // Corner region of the grown box: intersect with the corner's circle instead
+                Math::Vector2 corner(point.x < box.minX ? box.minX : box.maxX,
+                                     point.y < box.minY ? box.minY : box.maxY);
+                float time;
+                if (!rayVsCircle(center, displacement, corner, radius, time)) {
+                    return SweepHit::none();
+                }
+
+                Math::Vector2 hitCenter = center + displacement * time;
+                return {true, time, (hitCenter - corner).normalized()};
+            }
+
+        private:
+            static float dot(const Math::Vector2& a, const Math::Vector2& b) {
+                return a.x * b.x + a.y * b.y;
+            }
+
+            // Narrows [entry, exit] to the times the ray is inside [low, high] on one axis
+            static bool clipSlab(float start, float delta, float low, float high, const Math::Vector2& axis,
+                                 float& entry, float& exit, Math::Vector2& normal) {
+                if (delta == 0.0f) {
+                    return start >= low && start <= high;
+                }
+
+                float inverse = 1.0f / delta;
+                float nearTime = (low - start) * inverse;
+                float farTime = (high - start) * inverse;
+                float sign = -1.0f;
+                if (nearTime > farTime) {
+                    std::swap(nearTime, farTime);
+                    sign = 1.0f;
+                }
+
+                if (nearTime > entry) {
+                    entry = nearTime;
+                    normal = axis * sign;
+                }
+                exit = std::min(exit, farTime);
+                return entry <= exit;
+            }
+
+            static bool rayVsCircle(const Math::Vector2& start, const Math::Vector2& delta,
+                                    const Math::Vector2& circleCenter, float radius, float& time) {
+                Math::Vector2 m = start - circleCenter;
+                float a = dot(delta, delta);
+                float b = dot(m, delta);
+                float c = dot(m, m) - radius * radius;
+                if (a == 0.0f || b >= 0.0f) {
+                    return false; // Not moving, or moving away from the corner
+                }
+
+                float discriminant = b * b - a * c;
+                if (discriminant < 0.0f) {
+                    return false;
+                }
+
+                time = (-b - std::sqrt(discriminant)) / a;
+                return time >= 0.0f && time <= 1.0f;
+            }
+
+            // Center inside the box: push out along the axis of least penetration
+            static Math::Vector2 insideNormal(const Math::Vector2& center, const AABB& box) {
+                float left = center.x - box.minX;
+                float right = box.maxX - center.x;
+                float top = center.y - box.minY;
+                float bottom = box.maxY - center.y;
+                float smallest = std::min(std::min(left, right), std::min(top, bottom));
+
+                if (smallest == left) return Math::Vector2(-1.0f, 0.0f);
+                if (smallest == right) return Math::Vector2(1.0f, 0.0f);
+                if (smallest == top) return Math::Vector2(0.0f, -1.0f);
+                return Math::Vector2(0.0f, 1.0f);
+            }
+        };
+    }
+}
@@ -1,6 +1,10 @@
 #pragma once
 #include "../Entities/Paddle.h"
 #include "../Entities/Ball.h"
+#include "../../../Engine/ECS/SlotMap.h"
+#include "../../../Engine/Math/Random.h"
+#include <cmath>
+#include <cstdint>
 
 enum class AIDifficulty {
     Easy,
@@ -8,19 +12,33 @@ enum class AIDifficulty {
     Hard
 };
 
+using PaddleHandle = Engine::ECS::SlotMap<Paddle>::Handle;
+
 class AIController {
 private:
-    Paddle* paddle;
+    // The paddle is looked up every tick, so a removed paddle is noticed instead of dereferenced
+    Engine::ECS::SlotMap<Paddle>* paddles;
+    PaddleHandle paddleHandle;
     AIDifficulty difficulty;
     float reactionDelay;
     float errorMargin;
     float maxSpeed;
     float targetY;
     float reactionTimer;
+    Engine::Math::Random random; // Aiming error
+
+    // The intercept is predicted once per ball trajectory (reset or bounce) and cached;
+    // the paddle starts heading for it reactionDelay seconds after the event
+    bool hasPrediction;
+    std::uint32_t predictedTrajectory;
+    float predictedY;
+    bool retargetPending;
 
 public:
-    AIController(Paddle* paddle, AIDifficulty difficulty)
-        : paddle(paddle), difficulty(difficulty), reactionTimer(0.0f), targetY(0.0f) {
+    AIController(Engine::ECS::SlotMap<Paddle>& paddles, PaddleHandle paddle, AIDifficulty difficulty,
+                 std::uint64_t seed = Engine::Math::Random::DEFAULT_SEED)
+        : paddles(&paddles), paddleHandle(paddle), difficulty(difficulty), reactionTimer(0.0f), targetY(0.0f),
+          random(seed), hasPrediction(false), predictedTrajectory(0), predictedY(0.0f), retargetPending(false) {
 
         switch(difficulty) {
             case AIDifficulty::Easy:
@@ -41,34 +59,33 @@ public:
         }
     }
 
-    void update(float deltaTime, Ball* ball) {
-        reactionTimer += deltaTime;
+    void update(float deltaTime, const Ball* ball) {
+        Paddle* paddle = paddles->get(paddleHandle);
+        if (!paddle || !ball) {
+            return;
+        }
 
-        // Only update target position after reaction delay
-        if (reactionTimer >= reactionDelay) {
+        if (!hasPrediction || ball->getTrajectoryVersion() != predictedTrajectory) {
+            hasPrediction = true;
+            predictedTrajectory = ball->getTrajectoryVersion();
+            predictedY = predictTarget(*paddle, *ball);
+            retargetPending = true;
             reactionTimer = 0.0f;
+        }
 
-            auto ballPos = ball->getPosition();
-            auto ballVel = ball->getVelocity();
-
-            // Predict where ball will be
-            if (ballVel.x > 0) { // Ball moving toward AI
-                targetY = ballPos.y;
-            } else {
-                // Return to center when ball is moving away
-                targetY = 300.0f; // Center of screen
+        if (retargetPending) {
+            reactionTimer += deltaTime;
+            if (reactionTimer >= reactionDelay) {
+                targetY = predictedY;
+                retargetPending = false;
             }
-
-            // Add some error based on difficulty
-            float error = (rand() % (int)(errorMargin * 2)) - errorMargin;
-            targetY += error;
         }
 
         float paddleCenterY = paddle->getCenterY();
         float diff = targetY - paddleCenterY;
 
         // Move paddle toward target with speed based on difficulty
-        if (abs(diff) > 5.0f) {
+        if (std::fabs(diff) > 5.0f) {
             if (diff < 0) {
                 paddle->moveUp(deltaTime * maxSpeed);
             } else {
@@ -77,6 +94,27 @@ public:
         }
     }
 
+    // Where the ball centre crosses x = planeX, bouncing between walls at minY and maxY
+    // (the centre reflects at minY + radius and maxY - radius). The path is unfolded into
+    // a straight line and folded back with a triangle wave, so any number of wall
+    // reflections costs the same. The ball must be moving toward the plane.
+    static float predictInterceptY(float x, float y, float velocityX, float velocityY, float radius,
+                                   float planeX, float minY, float maxY) {
+        float low = minY + radius;
+        float span = maxY - radius - low;
+        if (span <= 0.0f) {
+            return (minY + maxY) / 2.0f;
+        }
+
+        float time = (planeX - x) / velocityX;
+        float period = 2.0f * span;
+        float phase = std::fmod(y - low + velocityY * time, period);
+        if (phase < 0.0f) {
+            phase += period;
+        }
+        return low + (phase <= span ? phase : period - phase);
+    }
+
     void setDifficulty(AIDifficulty newDifficulty) {
         difficulty = newDifficulty;
 
@@ -98,4 +136,30 @@ public:
                 break;
         }
     }
+
+private:
+    // Paddle centre to aim for on the ball's current trajectory, including the aiming error
+    float predictTarget(const Paddle& paddle, const Ball& ball) {
+        auto ballPos = ball.getPosition();
+        auto ballVel = ball.getVelocity();
+        float radius = ball.getRadius();
+        sf::FloatRect bounds = paddle.getBounds();
+
+        // The ball touches the paddle face nearest to it
+        bool paddleOnRight = bounds.position.x > ballPos.x;
+        float planeX = paddleOnRight ? bounds.position.x - radius : bounds.position.x + bounds.size.x + radius;
+
+        float target;
+        if (ballVel.x * (planeX - ballPos.x) > 0) { // Ball moving toward AI (works for either side)
+            target = predictInterceptY(ballPos.x, ballPos.y, ballVel.x, ballVel.y, radius,
+                                       planeX, paddle.getMinY(), paddle.getMaxY());
+        } else {
+            // Return to center when ball is moving away
+            target = (paddle.getMinY() + paddle.getMaxY()) / 2.0f;
+        }
+
+        // Add some error based on difficulty
+        float error = random.range(-errorMargin, errorMargin);
+        return target + error;
+    }
 };
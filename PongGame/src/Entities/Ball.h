@@ -1,33 +1,38 @@
 #pragma once
 #include "GameEntity.h"
+#include "../../../Engine/Math/Random.h"
 #include <cmath>
-#include <cstdlib>
-#include <ctime>
+#include <cstdint>
 
 class Ball : public GameEntity {
 private:
     float radius;
     float initialSpeed;
     float currentSpeed;
+    // Bumped whenever the path changes in a way a wall-reflecting prediction cannot
+    // foresee (reset, paddle hit), so observers can cache their predictions
+    std::uint32_t trajectoryVersion;
+    // Serve angles and directions; seeded per ball so matches are reproducible
+    Engine::Math::Random random;
 
 public:
-    Ball(float x, float y, float radius, float speed)
-        : radius(radius), initialSpeed(speed), currentSpeed(speed) {
+    Ball(float x, float y, float radius, float speed, std::uint64_t seed = Engine::Math::Random::DEFAULT_SEED)
+        : radius(radius), initialSpeed(speed), currentSpeed(speed), trajectoryVersion(0), random(seed) {
         setPosition(x, y);
         setSize(radius * 2, radius * 2);
         setColor(sf::Color::White);
-        srand(static_cast<unsigned>(time(nullptr)));
     }
 
     void reset(float x, float y) {
         setPosition(x, y);
         currentSpeed = initialSpeed;
 
-        float angle = (rand() % 60 - 30) * 3.14159f / 180.0f;
-        float direction = (rand() % 2 == 0) ? 1.0f : -1.0f;
+        float angle = random.range(-30, 29) * 3.14159f / 180.0f;
+        float direction = random.nextBool() ? 1.0f : -1.0f;
 
         velocity.x = direction * currentSpeed * cos(angle);
         velocity.y = currentSpeed * sin(angle);
+        trajectoryVersion++;
     }
 
     void update(float deltaTime) override {
@@ -35,11 +40,8 @@ public:
         position.y += velocity.y * deltaTime;
     }
 
-    void render(sf::RenderWindow* window) override {
-        sf::CircleShape circle(radius);
-        circle.setPosition({position.x - radius, position.y - radius});
-        circle.setFillColor(color);
-        window->draw(circle);
+    EntityRenderData getRenderData() const override {
+        return {true, {position.x, position.y}, {radius * 2, radius * 2}, color};
     }
 
     void bounceY() {
@@ -49,6 +51,7 @@ public:
     void bounceX() {
         velocity.x = -velocity.x;
         currentSpeed *= 1.05f;
+        trajectoryVersion++;
     }
 
     void handlePaddleCollision(float paddleCenterY) {
@@ -62,12 +65,22 @@ public:
         velocity.y = -currentSpeed * sin(bounceAngle);
 
         currentSpeed *= 1.05f;
+        trajectoryVersion++;
     }
 
     float getRadius() const {
         return radius;
     }
 
+    // Speed after the next paddle bounce (already includes the speed-ups so far)
+    float getSpeed() const {
+        return currentSpeed;
+    }
+
+    std::uint32_t getTrajectoryVersion() const {
+        return trajectoryVersion;
+    }
+
     sf::FloatRect getBounds() const {
         return sf::FloatRect({position.x - radius, position.y - radius}, {radius * 2, radius * 2});
     }
@@ -1,7 +1,16 @@
 #pragma once
 #include "../../../Engine/ECS/Entity.h"
+#include "../../../Engine/Graphics/Renderer.h"
 #include <SFML/Graphics.hpp>
 
+// Plain copy of what is needed to draw an entity, safe to hand to the render thread
+struct EntityRenderData {
+    bool circle;
+    sf::Vector2f position; // Top-left for rectangles, center for circles
+    sf::Vector2f size;
+    sf::Color color;
+};
+
 // Game-specific base entity that adds rendering and SFML-specific features
 // This sits between the pure engine and specific game entities
 class GameEntity : public Engine::ECS::Entity {
@@ -14,8 +23,28 @@ public:
 
     virtual ~GameEntity() {}
 
-    // Game entities must implement rendering
-    virtual void render(sf::RenderWindow* window) = 0;
+    // Game entities describe how they are drawn; drawing itself happens from the copied data
+    virtual EntityRenderData getRenderData() const = 0;
+
+    void render(Engine::Graphics::Renderer* renderer) const {
+        drawRenderData(getRenderData(), renderer);
+    }
+
+    static void drawRenderData(const EntityRenderData& data, Engine::Graphics::Renderer* renderer) {
+        if (data.circle) {
+            renderer->drawCircle(data.position, data.size.x / 2.0f, data.color);
+        } else {
+            renderer->drawRectangle(data.position, data.size, data.color);
+        }
+    }
+
+    // current, moved alpha (0..1) of the way from previous's position towards its own
+    static EntityRenderData interpolate(const EntityRenderData& previous, const EntityRenderData& current,
+                                        float alpha) {
+        EntityRenderData blended = current;
+        blended.position = previous.position + (current.position - previous.position) * alpha;
+        return blended;
+    }
 
     // Game-specific setters
     void setSize(float width, float height) {
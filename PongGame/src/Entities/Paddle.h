@@ -34,14 +34,19 @@ public:
         }
     }
 
-    void render(sf::RenderWindow* window) override {
-        sf::RectangleShape rect(size);
-        rect.setPosition({position.x, position.y});
-        rect.setFillColor(color);
-        window->draw(rect);
+    EntityRenderData getRenderData() const override {
+        return {false, {position.x, position.y}, size, color};
     }
 
     float getCenterY() const {
         return position.y + size.y / 2.0f;
     }
+
+    float getMinY() const {
+        return minY;
+    }
+
+    float getMaxY() const {
+        return maxY;
+    }
 };
@@ -0,0 +1,315 @@
+#pragma once
+#include "../../Engine/Core/JobSystem.h"
+#include "../../Engine/Math/Random.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+struct PongBatchConfig {
+    float fieldWidth = 800.0f;
+    float fieldHeight = 600.0f;
+    float paddleInset = 30.0f;
+    float paddleWidth = 15.0f;
+    float paddleHeight = 100.0f;
+    float paddleSpeed = 400.0f;
+    float ballRadius = 8.0f;
+    float ballSpeed = 300.0f;
+    float tickTime = 1.0f / 120.0f;
+    // A match ends when either side reaches this score, or after maxSteps steps (0: no limit)
+    int pointsToWin = 11;
+    std::uint32_t maxSteps = 0;
+};
+
+// Headless Pong for training and evaluating paddle agents: N independent matches held
+// in structure-of-arrays form and advanced together, one fixed tick per step().
+// The rules are PongGame's: wall reflections, the paddle bounce angle and 5% speed-up of
+// Ball::handlePaddleCollision, goals and the random serve of Ball::reset. Paddle contact
+// is swept against the paddle face (extended by the ball radius above and below), so
+// fast balls cannot tunnel; the rounded corner cases of Sweep::circleVsAABB are not modelled.
+//
+// step() works on chunks of matches: a branch-free integrate-and-wall-bounce pass the
+// compiler can vectorise, scalar passes for the rare paddle hits (with their trig), goals
+// and finished matches, and the copy-out of observations. With a JobSystem the chunks run in parallel; results do not depend on
+// the thread count.
+class PongBatchEnv {
+public:
+    // Per match: ball x, ball y, ball velocity x, ball velocity y, left paddle centre y,
+    // right paddle centre y
+    static constexpr std::size_t OBSERVATION_SIZE = 6;
+    // Per match: left paddle, right paddle; -1 up, 0 hold, +1 down
+    static constexpr std::size_t ACTIONS_PER_MATCH = 2;
+    static constexpr std::size_t CHUNK_SIZE = 2048;
+
+private:
+    PongBatchConfig config;
+    std::size_t matchCount;
+    Engine::Core::JobSystem* jobs;
+
+    std::vector<float> ballX;
+    std::vector<float> ballY;
+    std::vector<float> ballVelocityX;
+    std::vector<float> ballVelocityY;
+    std::vector<float> ballSpeed;
+    std::vector<float> leftPaddleY; // Top edge, like Paddle's position
+    std::vector<float> rightPaddleY;
+    std::vector<int> leftScore;
+    std::vector<int> rightScore;
+    std::vector<std::uint32_t> stepCount;
+    std::vector<Engine::Math::Random> random;
+
+    // Set by integrate for the balls resolvePaddleHits has to bounce
+    std::vector<std::uint8_t> paddleHits;
+
+public:
+    // jobs may be nullptr to step on the calling thread only
+    PongBatchEnv(std::size_t matchCount, const PongBatchConfig& config = PongBatchConfig(),
+                 Engine::Core::JobSystem* jobs = nullptr)
+        : config(config), matchCount(matchCount), jobs(jobs),
+          ballX(matchCount), ballY(matchCount), ballVelocityX(matchCount), ballVelocityY(matchCount),
+          ballSpeed(matchCount), leftPaddleY(matchCount), rightPaddleY(matchCount),
+          leftScore(matchCount), rightScore(matchCount), stepCount(matchCount), random(matchCount),
+          paddleHits(matchCount) {
+        resetFromSeed(0);
+    }
+
+    // Restarts every match; match i draws its serves from seeds[i]
+    void reset(const std::uint64_t* seeds, float* observations = nullptr) {
+        for (std::size_t i = 0; i < matchCount; i++) {
+            random[i].reseed(seeds[i]);
+            resetMatch(i);
+        }
+        if (observations) {
+            writeObservations(0, matchCount, observations);
+        }
+    }
+
+    // Restarts every match from one seed, each match on its own random stream
+    void resetFromSeed(std::uint64_t seed, float* observations = nullptr) {
+        for (std::size_t i = 0; i < matchCount; i++) {
+            random[i].reseed(seed, i);
+            resetMatch(i);
+        }
+        if (observations) {
+            writeObservations(0, matchCount, observations);
+        }
+    }
+
+    // Advances every match by one tick. actions holds ACTIONS_PER_MATCH entries per match;
+    // observations receives OBSERVATION_SIZE floats per match, rewards and dones one
+    // entry each. The reward is from the left paddle's side: +1 when it scores, -1 when
+    // it concedes (negate it for the right paddle). A done match is restarted right away
+    // and its observation is the first one of the new match.
+    void step(const std::int8_t* actions, float* observations, float* rewards, std::uint8_t* dones) {
+        auto stepRange = [&](std::size_t begin, std::size_t end) {
+            integrate(begin, end, actions);
+            resolvePaddleHits(begin, end);
+            resolveGoals(begin, end, rewards, dones);
+            writeObservations(begin, end, observations);
+        };
+
+        if (jobs && matchCount > CHUNK_SIZE) {
+            jobs->parallelFor(0, matchCount, CHUNK_SIZE, stepRange);
+        } else {
+            stepRange(0, matchCount);
+        }
+    }
+
+    std::size_t getMatchCount() const {
+        return matchCount;
+    }
+
+    const PongBatchConfig& getConfig() const {
+        return config;
+    }
+
+    int getLeftScore(std::size_t match) const {
+        return leftScore[match];
+    }
+
+    int getRightScore(std::size_t match) const {
+        return rightScore[match];
+    }
+
+    // Places a match's ball, e.g. to start from a situation taken from PongGame; speed is
+    // the one its next paddle bounce uses (Ball::getSpeed)
+    void setBall(std::size_t match, float x, float y, float velocityX, float velocityY, float speed) {
+        ballX[match] = x;
+        ballY[match] = y;
+        ballVelocityX[match] = velocityX;
+        ballVelocityY[match] = velocityY;
+        ballSpeed[match] = speed;
+    }
+
+private:
+    void integrate(std::size_t begin, std::size_t end, const std::int8_t* actions) {
+        const float dt = config.tickTime;
+        const float radius = config.ballRadius;
+        const float low = radius;
+        const float high = config.fieldHeight - radius;
+        const float paddleTravel = config.paddleSpeed * dt;
+        const float paddleMaxY = config.fieldHeight - config.paddleHeight;
+        const float paddleHeight = config.paddleHeight;
+        const float leftFace = config.paddleInset + config.paddleWidth + radius;
+        const float rightFace = config.fieldWidth - config.paddleInset - config.paddleWidth - radius;
+
+        float* x = ballX.data();
+        float* y = ballY.data();
+        const float* vx = ballVelocityX.data();
+        float* vy = ballVelocityY.data();
+        float* left = leftPaddleY.data();
+        float* right = rightPaddleY.data();
+        std::uint8_t* hits = paddleHits.data();
+
+        // Only arithmetic, comparisons and selects, so the compiler can vectorise it. A ball
+        // that reaches a paddle is handed to resolvePaddleHits with its contact fraction and
+        // contact y parked in its x and y. The arrays are separate vectors, which the compiler
+        // cannot prove by itself and would otherwise check for at run time, one pair at a time.
+#if defined(__clang__)
+        #pragma clang loop vectorize(assume_safety)
+#elif defined(__GNUC__)
+        #pragma GCC ivdep
+#elif defined(_MSC_VER)
+        #pragma loop(ivdep)
+#endif
+        for (std::size_t i = begin; i < end; i++) {
+            // Paddles move first, as in PongGame::updateGameplay
+            left[i] = std::min(std::max(left[i] + actions[2 * i] * paddleTravel, 0.0f), paddleMaxY);
+            right[i] = std::min(std::max(right[i] + actions[2 * i + 1] * paddleTravel, 0.0f), paddleMaxY);
+
+            float nextX = x[i] + vx[i] * dt;
+            float nextY = y[i] + vy[i] * dt;
+
+            // Crossing the face of the paddle the ball is heading for (extended by the ball
+            // radius above and below), at this fraction of the tick; NaN or outside [0, 1)
+            // when it does not cross, and hitY is then meaningless. No select feeds the
+            // arithmetic: GCC would sink it into branches, which the default -ftrapping-math
+            // then keeps from being if-converted back.
+            bool towardLeft = vx[i] < 0.0f;
+            float face = towardLeft ? leftFace : rightFace;
+            float paddleTop = towardLeft ? left[i] : right[i];
+            float fraction = (face - x[i]) / (nextX - x[i]);
+            float hitY = std::min(std::max(y[i] + vy[i] * dt * fraction, low), high);
+            bool hit = (fraction >= 0.0f) & (fraction < 1.0f) &
+                       (hitY >= paddleTop - radius) & (hitY <= paddleTop + paddleHeight + radius);
+            hits[i] = hit ? 1 : 0;
+
+            // Wall reflections: a ball past a wall is mirrored back about it, one inside the
+            // field is its own max/min and stays exactly where it is
+            bool bounces = (nextY < low) | (nextY > high);
+            nextY = std::max(nextY, 2.0f * low - nextY);
+            nextY = std::min(nextY, 2.0f * high - nextY);
+
+            x[i] = hit ? fraction : nextX;
+            y[i] = hit ? hitY : nextY;
+            vy[i] = bounces ? -vy[i] : vy[i]; // Replaced anyway after a paddle hit
+        }
+    }
+
+    // Ball::handlePaddleCollision for the few balls that reached a paddle this tick: the
+    // bounce angle and 5% speed-up at the contact, then the rest of the step from there
+    void resolvePaddleHits(std::size_t begin, std::size_t end) {
+        const float dt = config.tickTime;
+        const float low = config.ballRadius;
+        const float high = config.fieldHeight - config.ballRadius;
+        const float leftFace = config.paddleInset + config.paddleWidth + config.ballRadius;
+        const float rightFace = config.fieldWidth - config.paddleInset - config.paddleWidth - config.ballRadius;
+        const float halfPaddle = config.paddleHeight / 2.0f;
+        const float maxBounceAngle = 60.0f * 3.14159f / 180.0f;
+
+        for (std::size_t i = begin; i < end; i++) {
+            if (!paddleHits[i]) {
+                continue;
+            }
+
+            float fraction = ballX[i];
+            float hitY = ballY[i];
+
+            bool towardLeft = ballVelocityX[i] < 0.0f;
+            float paddleTop = towardLeft ? leftPaddleY[i] : rightPaddleY[i];
+            float bounceAngle = (paddleTop + halfPaddle - hitY) / halfPaddle * maxBounceAngle;
+            float bounceX = (towardLeft ? 1.0f : -1.0f) * ballSpeed[i] * std::cos(bounceAngle);
+            float bounceY = -ballSpeed[i] * std::sin(bounceAngle);
+            float rest = dt * (1.0f - fraction);
+
+            float nextX = (towardLeft ? leftFace : rightFace) + bounceX * rest;
+            float nextY = hitY + bounceY * rest;
+            if (nextY < low) {
+                nextY = 2.0f * low - nextY;
+                bounceY = -bounceY;
+            } else if (nextY > high) {
+                nextY = 2.0f * high - nextY;
+                bounceY = -bounceY;
+            }
+
+            ballX[i] = nextX;
+            ballY[i] = nextY;
+            ballVelocityX[i] = bounceX;
+            ballVelocityY[i] = bounceY;
+            ballSpeed[i] *= 1.05f;
+        }
+    }
+
+    void resolveGoals(std::size_t begin, std::size_t end, float* rewards, std::uint8_t* dones) {
+        const float radius = config.ballRadius;
+
+        for (std::size_t i = begin; i < end; i++) {
+            float reward = 0.0f;
+            if (ballX[i] - radius <= 0.0f) {
+                rightScore[i]++;
+                reward = -1.0f;
+                serve(i);
+            } else if (ballX[i] + radius >= config.fieldWidth) {
+                leftScore[i]++;
+                reward = 1.0f;
+                serve(i);
+            }
+
+            stepCount[i]++;
+            bool done = leftScore[i] >= config.pointsToWin || rightScore[i] >= config.pointsToWin ||
+                        (config.maxSteps > 0 && stepCount[i] >= config.maxSteps);
+            if (done) {
+                resetMatch(i);
+            }
+
+            rewards[i] = reward;
+            dones[i] = done ? 1 : 0;
+        }
+    }
+
+    void writeObservations(std::size_t begin, std::size_t end, float* observations) const {
+        const float halfPaddle = config.paddleHeight / 2.0f;
+        for (std::size_t i = begin; i < end; i++) {
+            float* out = observations + i * OBSERVATION_SIZE;
+            out[0] = ballX[i];
+            out[1] = ballY[i];
+            out[2] = ballVelocityX[i];
+            out[3] = ballVelocityY[i];
+            out[4] = leftPaddleY[i] + halfPaddle;
+            out[5] = rightPaddleY[i] + halfPaddle;
+        }
+    }
+
+    void resetMatch(std::size_t i) {
+        float paddleY = config.fieldHeight / 2.0f - config.paddleHeight / 2.0f;
+        leftPaddleY[i] = paddleY;
+        rightPaddleY[i] = paddleY;
+        leftScore[i] = 0;
+        rightScore[i] = 0;
+        stepCount[i] = 0;
+        serve(i);
+    }
+
+    // Ball::reset: from the centre at the initial speed, up to 30 degrees off horizontal
+    void serve(std::size_t i) {
+        ballX[i] = config.fieldWidth / 2.0f;
+        ballY[i] = config.fieldHeight / 2.0f;
+        ballSpeed[i] = config.ballSpeed;
+
+        float angle = random[i].range(-30, 29) * 3.14159f / 180.0f;
+        float direction = random[i].nextBool() ? 1.0f : -1.0f;
+
+        ballVelocityX[i] = direction * ballSpeed[i] * std::cos(angle);
+        ballVelocityY[i] = ballSpeed[i] * std::sin(angle);
+    }
+};
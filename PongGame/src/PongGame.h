@@ -1,6 +1,9 @@
 #pragma once
 #include "../../Engine/Core/Application.h"
+#include "../../Engine/Graphics/RenderLayer.h"
 #include "../../Engine/Graphics/SimpleFont.h"
+#include "../../Engine/Graphics/TextCache.h"
+#include "../../Engine/Physics/Sweep.h"
 #include "Entities/Paddle.h"
 #include "Entities/Ball.h"
 #include "AI/AIController.h"
@@ -16,15 +19,70 @@ enum class GameState {
 
 enum class GameMode {
     TwoPlayer,
-    VsAI
+    VsAI,
+    AIVsAI
+};
+
+// Everything the render functions read, copied out of the simulation once per frame.
+// In pipelined mode the update thread fills one slot while the main thread draws the other.
+struct PongRenderState {
+    GameState gameState;
+    GameState previousState;
+    GameMode gameMode;
+    AIDifficulty aiDifficulty;
+    bool selectingDifficulty;
+    int selectedMenuOption;
+    int selectedDifficultyOption;
+    int selectedPauseOption;
+    int selectedExitOption;
+    int leftScore;
+    int rightScore;
+    EntityRenderData leftPaddle;
+    EntityRenderData rightPaddle;
+    EntityRenderData ball;
 };
 
 class PongGame : public Engine::Core::Application {
 private:
-    Paddle* leftPaddle;
-    Paddle* rightPaddle;
-    Ball* ball;
-    AIController* aiController;
+    using BallHandle = Engine::ECS::SlotMap<Ball>::Handle;
+    using AIHandle = Engine::ECS::SlotMap<AIController>::Handle;
+
+    // Game objects are stored by value and referenced through generational handles
+    Engine::ECS::SlotMap<Paddle> paddles;
+    Engine::ECS::SlotMap<Ball> balls;
+    Engine::ECS::SlotMap<AIController> aiControllers;
+
+    PaddleHandle leftPaddle;
+    PaddleHandle rightPaddle;
+    BallHandle ball;
+    // Both controllers live as long as the game; starting a match only picks which are active
+    AIHandle rightAI;
+    AIHandle leftAI;
+    AIHandle aiController;     // rightAI or null
+    AIHandle leftAIController; // leftAI in AIVsAI mode, otherwise null
+
+    // Menu and HUD labels are constant, so their meshes are built once and reused
+    Engine::Graphics::TextCache textCache;
+
+    // Center line, scores and HUD labels; redrawn when a score or the mode changes
+    Engine::Graphics::RenderLayer fieldLayer;
+    // Whichever menu, pause overlay or dialog is showing; redrawn when the selection changes
+    Engine::Graphics::RenderLayer menuLayer;
+
+    PongRenderState renderStates[RENDER_SLOTS];
+
+    // Where the paddles and ball were drawn at the end of the previous tick. Frames blend
+    // from there to the current tick by the interpolation alpha, so motion stays smooth when
+    // the display rate is not a multiple of the tick rate.
+    EntityRenderData previousLeftPaddle;
+    EntityRenderData previousRightPaddle;
+    EntityRenderData previousBall;
+
+    // Paddle controls, resolved to ids once so each tick only tests bits
+    Engine::Input::ActionId leftUpAction;
+    Engine::Input::ActionId leftDownAction;
+    Engine::Input::ActionId rightUpAction;
+    Engine::Input::ActionId rightDownAction;
 
     int leftScore;
     int rightScore;
@@ -47,42 +105,105 @@ private:
     const float PADDLE_SPEED = 400.0f;
     const float BALL_RADIUS = 8.0f;
     const float BALL_SPEED = 300.0f;
+    // Bounces resolved per tick; a ball wedged between a wall and a paddle drops the rest of the step
+    const int MAX_BALL_CONTACTS = 8;
 
 public:
-    PongGame() : Engine::Core::Application("Pong Game", 800, 600),
+    static constexpr float TICKS_PER_SECOND = 120.0f;
+
+    // Headless games skip the menus and run an AI vs AI match, unless startInMenu (as a
+    // replay of a windowed session must). The seed decides every serve and AI aiming
+    // error, so two games with the same seed and inputs play alike.
+    PongGame(bool headless = false, std::uint64_t seed = Engine::Math::Random::DEFAULT_SEED,
+             bool startInMenu = false)
+        : Engine::Core::Application("Pong Game", 800, 600, headless),
+        fieldLayer(800, 600), menuLayer(800, 600),
         leftScore(0), rightScore(0), gameState(GameState::MainMenu),
         gameMode(GameMode::TwoPlayer), aiDifficulty(AIDifficulty::Medium),
         selectedMenuOption(0), selectedDifficultyOption(1), selectedPauseOption(0),
         selectedExitOption(1), selectingDifficulty(false),
-        previousState(GameState::MainMenu), aiController(nullptr) {
+        previousState(GameState::MainMenu) {
+
+        leftPaddle = paddles.emplace(30, WINDOW_HEIGHT / 2 - PADDLE_HEIGHT / 2,
+                                     PADDLE_WIDTH, PADDLE_HEIGHT, PADDLE_SPEED);
+        paddles.at(leftPaddle).setBounds(0, WINDOW_HEIGHT);
+
+        rightPaddle = paddles.emplace(WINDOW_WIDTH - 30 - PADDLE_WIDTH,
+                                      WINDOW_HEIGHT / 2 - PADDLE_HEIGHT / 2,
+                                      PADDLE_WIDTH, PADDLE_HEIGHT, PADDLE_SPEED);
+        paddles.at(rightPaddle).setBounds(0, WINDOW_HEIGHT);
+
+        Engine::Math::Random seeds(seed);
+        ball = balls.emplace(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2, BALL_RADIUS, BALL_SPEED, seeds.next64());
+        serveBall();
+        previousLeftPaddle = paddles.at(leftPaddle).getRenderData();
+        previousRightPaddle = paddles.at(rightPaddle).getRenderData();
+
+        rightAI = aiControllers.emplace(paddles, rightPaddle, aiDifficulty, seeds.next64());
+        leftAI = aiControllers.emplace(paddles, leftPaddle, aiDifficulty, seeds.next64());
+
+        Engine::Input::InputSystem& controls = getInput();
+        leftUpAction = controls.bindAction("left_up", sf::Keyboard::Key::W);
+        leftDownAction = controls.bindAction("left_down", sf::Keyboard::Key::S);
+        rightUpAction = controls.bindAction("right_up", sf::Keyboard::Key::Up);
+        rightDownAction = controls.bindAction("right_down", sf::Keyboard::Key::Down);
+
+        if (headless && !startInMenu) {
+            gameMode = GameMode::AIVsAI;
+            startGame();
+        }
+    }
 
-        leftPaddle = new Paddle(30, WINDOW_HEIGHT / 2 - PADDLE_HEIGHT / 2,
-                                PADDLE_WIDTH, PADDLE_HEIGHT, PADDLE_SPEED);
-        leftPaddle->setBounds(0, WINDOW_HEIGHT);
+    int getLeftScore() const {
+        return leftScore;
+    }
 
-        rightPaddle = new Paddle(WINDOW_WIDTH - 30 - PADDLE_WIDTH,
-                                 WINDOW_HEIGHT / 2 - PADDLE_HEIGHT / 2,
-                                 PADDLE_WIDTH, PADDLE_HEIGHT, PADDLE_SPEED);
-        rightPaddle->setBounds(0, WINDOW_HEIGHT);
+    int getRightScore() const {
+        return rightScore;
+    }
 
-        ball = new Ball(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2, BALL_RADIUS, BALL_SPEED);
-        ball->reset(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
+    const Ball& getBall() const {
+        return balls.at(ball);
     }
 
-    ~PongGame() {
-        delete leftPaddle;
-        delete rightPaddle;
-        delete ball;
-        if (aiController) {
-            delete aiController;
-        }
+    const Paddle& getLeftPaddle() const {
+        return paddles.at(leftPaddle);
+    }
+
+    const Paddle& getRightPaddle() const {
+        return paddles.at(rightPaddle);
     }
 
 protected:
     void onStart() override {
+        // Simulate at a steady 120 Hz so a hitch cannot hand the ball a huge dt
+        setFixedTimestep(TICKS_PER_SECOND);
+        // Menus, the pause screen and the exit dialog only change on input
+        setIdleWait(true);
+    }
+
+    bool isAnimating() const override {
+        return gameState == GameState::Playing;
     }
 
     void update(float deltaTime) override {
+        if (!isHeadless()) { // Nothing is drawn, so there is nothing to interpolate
+            previousLeftPaddle = paddles.at(leftPaddle).getRenderData();
+            previousRightPaddle = paddles.at(rightPaddle).getRenderData();
+            previousBall = balls.at(ball).getRenderData();
+        }
+
+        // Menu navigation reads the same per-tick snapshot as gameplay, so a replayed
+        // snapshot drives the whole game. Menus also step on key repeat, as a held arrow
+        // key did when they ran from KeyPressed events; gameplay keys (R, Escape) do not.
+        const Engine::Input::InputSnapshot& snapshot = getInput().getSnapshot();
+        snapshot.forEachPressedOrRepeatedKey([this, &snapshot](sf::Keyboard::Key key) {
+            if (gameState == GameState::Playing && !snapshot.wasKeyPressed(key)) {
+                return;
+            }
+            handleKeyPressed(key);
+        });
+
         if (gameState == GameState::MainMenu || gameState == GameState::Paused ||
             gameState == GameState::ExitConfirmation) {
             // Menu states don't need update logic
@@ -95,92 +216,184 @@ protected:
     }
 
     void updateGameplay(float deltaTime) {
-        // Player 1 controls (always human)
-        if (Engine::Input::Input::isKeyPressed(sf::Keyboard::Key::W)) {
-            leftPaddle->moveUp(deltaTime);
-        }
-        if (Engine::Input::Input::isKeyPressed(sf::Keyboard::Key::S)) {
-            leftPaddle->moveDown(deltaTime);
+        // Player 1 controls (human unless AI vs AI)
+        if (gameMode == GameMode::AIVsAI) {
+            if (AIController* ai = aiControllers.get(leftAIController)) {
+                ai->update(deltaTime, balls.get(ball));
+            }
+        } else {
+            if (getInput().isActionDown(leftUpAction)) {
+                paddles.at(leftPaddle).moveUp(deltaTime);
+            }
+            if (getInput().isActionDown(leftDownAction)) {
+                paddles.at(leftPaddle).moveDown(deltaTime);
+            }
         }
 
         // Player 2 controls (human or AI)
         if (gameMode == GameMode::TwoPlayer) {
-            if (Engine::Input::Input::isKeyPressed(sf::Keyboard::Key::Up)) {
-                rightPaddle->moveUp(deltaTime);
+            if (getInput().isActionDown(rightUpAction)) {
+                paddles.at(rightPaddle).moveUp(deltaTime);
             }
-            if (Engine::Input::Input::isKeyPressed(sf::Keyboard::Key::Down)) {
-                rightPaddle->moveDown(deltaTime);
+            if (getInput().isActionDown(rightDownAction)) {
+                paddles.at(rightPaddle).moveDown(deltaTime);
             }
         } else {
             // AI controls right paddle
-            if (aiController) {
-                aiController->update(deltaTime, ball);
+            if (AIController* ai = aiControllers.get(aiController)) {
+                ai->update(deltaTime, balls.get(ball));
             }
         }
 
-        // ESC handled in onEvent for pause menu
+        // ESC handled in handleGameplayInput for pause menu
 
-        ball->update(deltaTime);
-        checkCollisions();
+        moveBall(deltaTime);
     }
 
-    void checkCollisions() {
-        auto ballPos = ball->getPosition();
-        float ballRadius = ball->getRadius();
+    // Swept movement: the ball is advanced to the earliest time of impact, bounced, and
+    // the rest of the step continues from there, so it cannot pass through a paddle or
+    // wall no matter how fast it goes or how large deltaTime is.
+    void moveBall(float deltaTime) {
+        float remaining = deltaTime;
+
+        for (int contact = 0; contact < MAX_BALL_CONTACTS && remaining > 0.0f; contact++) {
+            auto ballPos = balls.at(ball).getPosition();
+            auto ballVel = balls.at(ball).getVelocity();
+            Engine::Math::Vector2 center(ballPos.x, ballPos.y);
+            Engine::Math::Vector2 displacement(ballVel.x * remaining, ballVel.y * remaining);
+            float ballRadius = balls.at(ball).getRadius();
+
+            // Earliest hit wins; obstacle: 0 top wall, 1 bottom wall, 2 left paddle, 3 right paddle
+            Engine::Physics::SweepHit hits[4] = {
+                Engine::Physics::Sweep::circleVsPlane(center, ballRadius, displacement,
+                                                      Engine::Math::Vector2(0.0f, 1.0f), 0.0f),
+                Engine::Physics::Sweep::circleVsPlane(center, ballRadius, displacement,
+                                                      Engine::Math::Vector2(0.0f, -1.0f), -WINDOW_HEIGHT),
+                Engine::Physics::Sweep::circleVsAABB(center, ballRadius, displacement, toAABB(paddles.at(leftPaddle).getBounds())),
+                Engine::Physics::Sweep::circleVsAABB(center, ballRadius, displacement, toAABB(paddles.at(rightPaddle).getBounds()))
+            };
+
+            int obstacle = -1;
+            for (int i = 0; i < 4; i++) {
+                if (hits[i].hit && (obstacle < 0 || hits[i].time < hits[obstacle].time)) {
+                    obstacle = i;
+                }
+            }
+            if (obstacle < 0) {
+                balls.at(ball).update(remaining);
+                break;
+            }
 
-        if (ballPos.y - ballRadius <= 0 || ballPos.y + ballRadius >= WINDOW_HEIGHT) {
-            ball->bounceY();
-        }
+            float travelled = remaining * hits[obstacle].time;
+            balls.at(ball).update(travelled);
+            remaining -= travelled;
 
-        if (ball->getBounds().findIntersection(leftPaddle->getBounds()).has_value()) {
-            ball->handlePaddleCollision(leftPaddle->getCenterY());
+            if (obstacle < 2) {
+                balls.at(ball).bounceY();
+            } else if (obstacle == 2) {
+                balls.at(ball).handlePaddleCollision(paddles.at(leftPaddle).getCenterY());
+            } else {
+                balls.at(ball).handlePaddleCollision(paddles.at(rightPaddle).getCenterY());
+            }
         }
 
-        if (ball->getBounds().findIntersection(rightPaddle->getBounds()).has_value()) {
-            ball->handlePaddleCollision(rightPaddle->getCenterY());
-        }
+        checkGoals();
+    }
+
+    static Engine::Physics::AABB toAABB(const sf::FloatRect& rect) {
+        return Engine::Physics::AABB::fromRect(rect.position.x, rect.position.y, rect.size.x, rect.size.y);
+    }
+
+    void checkGoals() {
+        auto ballPos = balls.at(ball).getPosition();
+        float ballRadius = balls.at(ball).getRadius();
 
         if (ballPos.x - ballRadius <= 0) {
             rightScore++;
-            ball->reset(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
+            serveBall();
         }
 
         if (ballPos.x + ballRadius >= WINDOW_WIDTH) {
             leftScore++;
-            ball->reset(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
+            serveBall();
         }
     }
 
     void render() override {
+        renderInterpolated(1.0f);
+    }
+
+    void renderInterpolated(float alpha) override {
+        captureRenderState(0, alpha);
+        renderSnapshot(0);
+    }
+
+    // Runs right after the update, so the alpha is the one of the frame being captured
+    void extractRenderState(std::size_t slot) override {
+        captureRenderState(slot, getInterpolationAlpha());
+    }
+
+    void captureRenderState(std::size_t slot, float alpha) {
+        PongRenderState& state = renderStates[slot];
+        state.gameState = gameState;
+        state.previousState = previousState;
+        state.gameMode = gameMode;
+        state.aiDifficulty = aiDifficulty;
+        state.selectingDifficulty = selectingDifficulty;
+        state.selectedMenuOption = selectedMenuOption;
+        state.selectedDifficultyOption = selectedDifficultyOption;
+        state.selectedPauseOption = selectedPauseOption;
+        state.selectedExitOption = selectedExitOption;
+        state.leftScore = leftScore;
+        state.rightScore = rightScore;
+        state.leftPaddle = GameEntity::interpolate(previousLeftPaddle, paddles.at(leftPaddle).getRenderData(), alpha);
+        state.rightPaddle = GameEntity::interpolate(previousRightPaddle, paddles.at(rightPaddle).getRenderData(), alpha);
+        state.ball = GameEntity::interpolate(previousBall, balls.at(ball).getRenderData(), alpha);
+    }
+
+    void renderSnapshot(std::size_t slot) override {
+        const PongRenderState& state = renderStates[slot];
+
         window->clear(sf::Color::Black);
 
-        if (gameState == GameState::MainMenu) {
-            renderMainMenu();
-        } else if (gameState == GameState::Playing) {
-            renderGameplay();
-        } else if (gameState == GameState::Paused) {
-            renderGameplay(); // Draw game in background
-            renderPauseMenu(); // Overlay pause menu
-        } else if (gameState == GameState::ExitConfirmation) {
-            if (previousState == GameState::Playing || previousState == GameState::Paused) {
-                renderGameplay();
+        if (state.gameState == GameState::MainMenu) {
+            menuLayer.setInputs(getMenuInputs(state));
+            menuLayer.draw(*renderer, [this, &state](sf::RenderTarget* target) {
+                renderMainMenu(state, target);
+            });
+        } else if (state.gameState == GameState::Playing) {
+            // Gameplay frames are held to the allocation budget; menus are not
+            markSteadyFrame();
+            renderGameplay(state);
+        } else if (state.gameState == GameState::Paused) {
+            renderGameplay(state); // Draw game in background
+            menuLayer.setInputs(getMenuInputs(state));
+            menuLayer.draw(*renderer, [this, &state](sf::RenderTarget* target) {
+                renderPauseMenu(state, target); // Overlay pause menu
+            });
+        } else if (state.gameState == GameState::ExitConfirmation) {
+            if (state.previousState == GameState::Playing || state.previousState == GameState::Paused) {
+                renderGameplay(state);
             }
-            renderExitConfirmation();
+            menuLayer.setInputs(getMenuInputs(state));
+            menuLayer.draw(*renderer, [this, &state](sf::RenderTarget* target) {
+                renderExitConfirmation(state, target);
+            });
         }
 
-        window->display();
+        renderer->display();
     }
 
-    void renderMainMenu() {
+    void renderMainMenu(const PongRenderState& state, sf::RenderTarget* target) {
         float centerX = WINDOW_WIDTH / 2;
 
         // Draw title with shadow effect
-        Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(), "PONG",
-                                                      centerX + 2, 62, 8.0f, sf::Color(40, 40, 40));
-        Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(), "PONG",
-                                                      centerX, 60, 8.0f, sf::Color::White);
+        textCache.drawTextCentered(target, "PONG",
+                                  centerX + 2, 62, 8.0f, sf::Color(40, 40, 40));
+        textCache.drawTextCentered(target, "PONG",
+                                  centerX, 60, 8.0f, sf::Color::White);
 
-        if (!selectingDifficulty) {
+        if (!state.selectingDifficulty) {
             // Main menu options with selection box
             float option1Y = 220;
             float option2Y = 300;
@@ -189,10 +402,10 @@ protected:
             // Draw selection box
             float boxWidth = 380;
             float boxY = option1Y;
-            if (selectedMenuOption == 1) {
+            if (state.selectedMenuOption == 1) {
                 boxWidth = 280;
                 boxY = option2Y;
-            } else if (selectedMenuOption == 2) {
+            } else if (state.selectedMenuOption == 2) {
                 boxWidth = 120;
                 boxY = option3Y;
             }
@@ -202,31 +415,31 @@ protected:
             selectionBox.setFillColor(sf::Color::Transparent);
             selectionBox.setOutlineColor(sf::Color::Yellow);
             selectionBox.setOutlineThickness(2);
-            window->getRenderWindow()->draw(selectionBox);
+            target->draw(selectionBox);
 
-            Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(), "PLAY WITH FRIEND",
-                                                          centerX, option1Y, 4.0f,
-                                                          selectedMenuOption == 0 ? sf::Color::Yellow : sf::Color::White);
+            textCache.drawTextCentered(target, "PLAY WITH FRIEND",
+                                      centerX, option1Y, 4.0f,
+                                      state.selectedMenuOption == 0 ? sf::Color::Yellow : sf::Color::White);
 
-            Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(), "PLAY VS AI",
-                                                          centerX, option2Y, 4.0f,
-                                                          selectedMenuOption == 1 ? sf::Color::Yellow : sf::Color::White);
+            textCache.drawTextCentered(target, "PLAY VS AI",
+                                      centerX, option2Y, 4.0f,
+                                      state.selectedMenuOption == 1 ? sf::Color::Yellow : sf::Color::White);
 
-            Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(), "EXIT",
-                                                          centerX, option3Y, 4.0f,
-                                                          selectedMenuOption == 2 ? sf::Color::Yellow : sf::Color::White);
+            textCache.drawTextCentered(target, "EXIT",
+                                      centerX, option3Y, 4.0f,
+                                      state.selectedMenuOption == 2 ? sf::Color::Yellow : sf::Color::White);
 
             // Instructions at bottom
-            Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(),
-                                                          "USE UP/DOWN TO SELECT",
-                                                          centerX, 480, 2.5f, sf::Color(120, 120, 120));
-            Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(),
-                                                          "PRESS ENTER TO CONFIRM",
-                                                          centerX, 510, 2.5f, sf::Color(120, 120, 120));
+            textCache.drawTextCentered(target,
+                                      "USE UP/DOWN TO SELECT",
+                                      centerX, 480, 2.5f, sf::Color(120, 120, 120));
+            textCache.drawTextCentered(target,
+                                      "PRESS ENTER TO CONFIRM",
+                                      centerX, 510, 2.5f, sf::Color(120, 120, 120));
         } else {
             // Difficulty selection
-            Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(), "SELECT DIFFICULTY",
-                                                          centerX, 160, 4.5f, sf::Color::White);
+            textCache.drawTextCentered(target, "SELECT DIFFICULTY",
+                                      centerX, 160, 4.5f, sf::Color::White);
 
             float easyY = 260;
             float mediumY = 340;
@@ -235,10 +448,10 @@ protected:
             // Draw selection box
             float boxY = easyY;
             float boxWidth = 120;
-            if (selectedDifficultyOption == 1) {
+            if (state.selectedDifficultyOption == 1) {
                 boxY = mediumY;
                 boxWidth = 180;
-            } else if (selectedDifficultyOption == 2) {
+            } else if (state.selectedDifficultyOption == 2) {
                 boxY = hardY;
                 boxWidth = 120;
             }
@@ -248,68 +461,92 @@ protected:
             selectionBox.setFillColor(sf::Color::Transparent);
             selectionBox.setOutlineColor(sf::Color::Yellow);
             selectionBox.setOutlineThickness(2);
-            window->getRenderWindow()->draw(selectionBox);
+            target->draw(selectionBox);
 
             // Draw difficulty options
-            Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(), "EASY",
-                                                          centerX, easyY, 4.0f,
-                                                          selectedDifficultyOption == 0 ? sf::Color::Yellow : sf::Color::White);
+            textCache.drawTextCentered(target, "EASY",
+                                      centerX, easyY, 4.0f,
+                                      state.selectedDifficultyOption == 0 ? sf::Color::Yellow : sf::Color::White);
 
-            Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(), "MEDIUM",
-                                                          centerX, mediumY, 4.0f,
-                                                          selectedDifficultyOption == 1 ? sf::Color::Yellow : sf::Color::White);
+            textCache.drawTextCentered(target, "MEDIUM",
+                                      centerX, mediumY, 4.0f,
+                                      state.selectedDifficultyOption == 1 ? sf::Color::Yellow : sf::Color::White);
 
-            Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(), "HARD",
-                                                          centerX, hardY, 4.0f,
-                                                          selectedDifficultyOption == 2 ? sf::Color::Yellow : sf::Color::White);
+            textCache.drawTextCentered(target, "HARD",
+                                      centerX, hardY, 4.0f,
+                                      state.selectedDifficultyOption == 2 ? sf::Color::Yellow : sf::Color::White);
 
             // Instructions
-            Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(),
-                                                          "PRESS ENTER TO CONFIRM",
-                                                          centerX, 520, 2.5f, sf::Color(120, 120, 120));
-            Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(),
-                                                          "ESC TO GO BACK",
-                                                          centerX, 545, 2.5f, sf::Color(120, 120, 120));
+            textCache.drawTextCentered(target,
+                                      "PRESS ENTER TO CONFIRM",
+                                      centerX, 520, 2.5f, sf::Color(120, 120, 120));
+            textCache.drawTextCentered(target,
+                                      "ESC TO GO BACK",
+                                      centerX, 545, 2.5f, sf::Color(120, 120, 120));
         }
     }
 
-    void renderGameplay() {
-        drawCenterLine();
+    // Everything the menu layer's content depends on
+    static std::uint64_t getMenuInputs(const PongRenderState& state) {
+        return static_cast<std::uint64_t>(state.gameState) |
+               static_cast<std::uint64_t>(state.previousState) << 8 |
+               static_cast<std::uint64_t>(state.selectingDifficulty) << 16 |
+               static_cast<std::uint64_t>(state.selectedMenuOption) << 24 |
+               static_cast<std::uint64_t>(state.selectedDifficultyOption) << 32 |
+               static_cast<std::uint64_t>(state.selectedPauseOption) << 40 |
+               static_cast<std::uint64_t>(state.selectedExitOption) << 48;
+    }
 
-        leftPaddle->render(window->getRenderWindow());
-        rightPaddle->render(window->getRenderWindow());
-        ball->render(window->getRenderWindow());
+    void renderGameplay(const PongRenderState& state) {
+        // The static part of the field is one cached quad; only paddles and ball are drawn live
+        fieldLayer.setInputs(static_cast<std::uint64_t>(static_cast<std::uint16_t>(state.leftScore)) |
+                             static_cast<std::uint64_t>(static_cast<std::uint16_t>(state.rightScore)) << 16 |
+                             static_cast<std::uint64_t>(state.gameMode) << 32 |
+                             static_cast<std::uint64_t>(state.aiDifficulty) << 40);
+        fieldLayer.draw(*renderer, [this, &state](sf::RenderTarget* target) {
+            renderField(state, target);
+        });
+
+        GameEntity::drawRenderData(state.leftPaddle, renderer);
+        GameEntity::drawRenderData(state.rightPaddle, renderer);
+        GameEntity::drawRenderData(state.ball, renderer);
+    }
 
-        drawScores();
+    void renderField(const PongRenderState& state, sf::RenderTarget* target) {
+        drawCenterLine();
+        drawScores(state);
+
+        // Submit the batched field before the HUD text is drawn on top of it
+        renderer->flush();
 
         // Draw mode indicator
-        if (gameMode == GameMode::VsAI) {
-            std::string diffText = "";
-            if (aiDifficulty == AIDifficulty::Easy) diffText = "AI: EASY";
-            else if (aiDifficulty == AIDifficulty::Medium) diffText = "AI: MEDIUM";
-            else if (aiDifficulty == AIDifficulty::Hard) diffText = "AI: HARD";
-
-            Engine::Graphics::SimpleFont::drawText(window->getRenderWindow(), diffText,
-                                                  WINDOW_WIDTH - 200, 10, 2.0f, sf::Color::White);
+        if (state.gameMode != GameMode::TwoPlayer) {
+            const char* diffText = "";
+            if (state.aiDifficulty == AIDifficulty::Easy) diffText = "AI: EASY";
+            else if (state.aiDifficulty == AIDifficulty::Medium) diffText = "AI: MEDIUM";
+            else if (state.aiDifficulty == AIDifficulty::Hard) diffText = "AI: HARD";
+
+            textCache.drawText(target, diffText,
+                              WINDOW_WIDTH - 200, 10, 2.0f, sf::Color::White);
         }
 
-        Engine::Graphics::SimpleFont::drawText(window->getRenderWindow(), "ESC: Pause",
-                                              10, 10, 2.0f, sf::Color::White);
-        Engine::Graphics::SimpleFont::drawText(window->getRenderWindow(), "R: Reset",
-                                              10, 35, 2.0f, sf::Color::White);
+        textCache.drawText(target, "ESC: Pause",
+                          10, 10, 2.0f, sf::Color::White);
+        textCache.drawText(target, "R: Reset",
+                          10, 35, 2.0f, sf::Color::White);
     }
 
-    void renderPauseMenu() {
+    void renderPauseMenu(const PongRenderState& state, sf::RenderTarget* target) {
         // Semi-transparent dark overlay
         sf::RectangleShape overlay({WINDOW_WIDTH, WINDOW_HEIGHT});
         overlay.setFillColor(sf::Color(0, 0, 0, 180));
-        window->getRenderWindow()->draw(overlay);
+        target->draw(overlay);
 
         float centerX = WINDOW_WIDTH / 2;
 
         // Title
-        Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(), "PAUSED",
-                                                      centerX, 100, 6.0f, sf::Color::White);
+        textCache.drawTextCentered(target, "PAUSED",
+                                  centerX, 100, 6.0f, sf::Color::White);
 
         // Menu options
         float resumeY = 220;
@@ -320,13 +557,13 @@ protected:
         // Draw selection boxes
         float boxWidth = 180;
         float boxY = resumeY;
-        if (selectedPauseOption == 1) {
+        if (state.selectedPauseOption == 1) {
             boxWidth = 200;
             boxY = restartY;
-        } else if (selectedPauseOption == 2) {
+        } else if (state.selectedPauseOption == 2) {
             boxWidth = 260;
             boxY = mainMenuY;
-        } else if (selectedPauseOption == 3) {
+        } else if (state.selectedPauseOption == 3) {
             boxWidth = 120;
             boxY = exitY;
         }
@@ -336,35 +573,35 @@ protected:
         selectionBox.setFillColor(sf::Color::Transparent);
         selectionBox.setOutlineColor(sf::Color::Yellow);
         selectionBox.setOutlineThickness(2);
-        window->getRenderWindow()->draw(selectionBox);
+        target->draw(selectionBox);
 
-        Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(), "RESUME",
-                                                      centerX, resumeY, 4.0f,
-                                                      selectedPauseOption == 0 ? sf::Color::Yellow : sf::Color::White);
+        textCache.drawTextCentered(target, "RESUME",
+                                  centerX, resumeY, 4.0f,
+                                  state.selectedPauseOption == 0 ? sf::Color::Yellow : sf::Color::White);
 
-        Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(), "RESTART",
-                                                      centerX, restartY, 4.0f,
-                                                      selectedPauseOption == 1 ? sf::Color::Yellow : sf::Color::White);
+        textCache.drawTextCentered(target, "RESTART",
+                                  centerX, restartY, 4.0f,
+                                  state.selectedPauseOption == 1 ? sf::Color::Yellow : sf::Color::White);
 
-        Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(), "MAIN MENU",
-                                                      centerX, mainMenuY, 4.0f,
-                                                      selectedPauseOption == 2 ? sf::Color::Yellow : sf::Color::White);
+        textCache.drawTextCentered(target, "MAIN MENU",
+                                  centerX, mainMenuY, 4.0f,
+                                  state.selectedPauseOption == 2 ? sf::Color::Yellow : sf::Color::White);
 
-        Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(), "EXIT",
-                                                      centerX, exitY, 4.0f,
-                                                      selectedPauseOption == 3 ? sf::Color::Yellow : sf::Color::White);
+        textCache.drawTextCentered(target, "EXIT",
+                                  centerX, exitY, 4.0f,
+                                  state.selectedPauseOption == 3 ? sf::Color::Yellow : sf::Color::White);
 
         // Instructions
-        Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(),
-                                                      "USE UP/DOWN TO SELECT",
-                                                      centerX, 530, 2.5f, sf::Color(150, 150, 150));
+        textCache.drawTextCentered(target,
+                                  "USE UP/DOWN TO SELECT",
+                                  centerX, 530, 2.5f, sf::Color(150, 150, 150));
     }
 
-    void renderExitConfirmation() {
+    void renderExitConfirmation(const PongRenderState& state, sf::RenderTarget* target) {
         // Semi-transparent dark overlay
         sf::RectangleShape overlay({WINDOW_WIDTH, WINDOW_HEIGHT});
         overlay.setFillColor(sf::Color(0, 0, 0, 200));
-        window->getRenderWindow()->draw(overlay);
+        target->draw(overlay);
 
         float centerX = WINDOW_WIDTH / 2;
 
@@ -374,17 +611,17 @@ protected:
         dialogBox.setFillColor(sf::Color(20, 20, 20));
         dialogBox.setOutlineColor(sf::Color::White);
         dialogBox.setOutlineThickness(3);
-        window->getRenderWindow()->draw(dialogBox);
+        target->draw(dialogBox);
 
         // Title
-        Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(),
-                                                      "ARE YOU SURE?",
-                                                      centerX, 220, 5.0f, sf::Color::White);
+        textCache.drawTextCentered(target,
+                                  "ARE YOU SURE?",
+                                  centerX, 220, 5.0f, sf::Color::White);
 
         // Message
-        Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(),
-                                                      "DO YOU WANT TO EXIT THE GAME?",
-                                                      centerX, 290, 2.5f, sf::Color(200, 200, 200));
+        textCache.drawTextCentered(target,
+                                  "DO YOU WANT TO EXIT THE GAME?",
+                                  centerX, 290, 2.5f, sf::Color(200, 200, 200));
 
         // Options
         float yesY = 360;
@@ -393,34 +630,34 @@ protected:
         float noX = centerX + 100;
 
         // Draw selection boxes
-        if (selectedExitOption == 0) {
+        if (state.selectedExitOption == 0) {
             sf::RectangleShape selectionBox({100, 50});
             selectionBox.setPosition({yesX - 50, yesY - 10});
             selectionBox.setFillColor(sf::Color::Transparent);
             selectionBox.setOutlineColor(sf::Color(255, 100, 100));
             selectionBox.setOutlineThickness(2);
-            window->getRenderWindow()->draw(selectionBox);
+            target->draw(selectionBox);
         } else {
             sf::RectangleShape selectionBox({80, 50});
             selectionBox.setPosition({noX - 40, noY - 10});
             selectionBox.setFillColor(sf::Color::Transparent);
             selectionBox.setOutlineColor(sf::Color(100, 255, 100));
             selectionBox.setOutlineThickness(2);
-            window->getRenderWindow()->draw(selectionBox);
+            target->draw(selectionBox);
         }
 
-        Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(), "YES",
-                                                      yesX, yesY, 4.0f,
-                                                      selectedExitOption == 0 ? sf::Color(255, 100, 100) : sf::Color::White);
+        textCache.drawTextCentered(target, "YES",
+                                  yesX, yesY, 4.0f,
+                                  state.selectedExitOption == 0 ? sf::Color(255, 100, 100) : sf::Color::White);
 
-        Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(), "NO",
-                                                      noX, noY, 4.0f,
-                                                      selectedExitOption == 1 ? sf::Color(100, 255, 100) : sf::Color::White);
+        textCache.drawTextCentered(target, "NO",
+                                  noX, noY, 4.0f,
+                                  state.selectedExitOption == 1 ? sf::Color(100, 255, 100) : sf::Color::White);
 
         // Instructions
-        Engine::Graphics::SimpleFont::drawTextCentered(window->getRenderWindow(),
-                                                      "LEFT/RIGHT TO SELECT  ENTER TO CONFIRM",
-                                                      centerX, 420, 2.0f, sf::Color(150, 150, 150));
+        textCache.drawTextCentered(target,
+                                  "LEFT/RIGHT TO SELECT  ENTER TO CONFIRM",
+                                  centerX, 420, 2.0f, sf::Color(150, 150, 150));
     }
 
     void drawCenterLine() {
@@ -462,39 +699,37 @@ protected:
         if (segments[6]) renderer->drawRectangle({x, y + height - thickness/2}, {width, thickness}, sf::Color::White);
     }
 
-    void drawScores() {
+    void drawScores(const PongRenderState& state) {
         float leftX = WINDOW_WIDTH / 4 - 20;
         float scoreY = 40;
         float digitSize = 60;
 
-        if (leftScore < 10) {
-            drawDigit(leftScore, leftX, scoreY, digitSize);
+        if (state.leftScore < 10) {
+            drawDigit(state.leftScore, leftX, scoreY, digitSize);
         } else {
-            drawDigit(leftScore / 10, leftX - 25, scoreY, digitSize);
-            drawDigit(leftScore % 10, leftX + 25, scoreY, digitSize);
+            drawDigit(state.leftScore / 10, leftX - 25, scoreY, digitSize);
+            drawDigit(state.leftScore % 10, leftX + 25, scoreY, digitSize);
         }
 
         float rightX = 3 * WINDOW_WIDTH / 4 - 20;
 
-        if (rightScore < 10) {
-            drawDigit(rightScore, rightX, scoreY, digitSize);
+        if (state.rightScore < 10) {
+            drawDigit(state.rightScore, rightX, scoreY, digitSize);
         } else {
-            drawDigit(rightScore / 10, rightX - 25, scoreY, digitSize);
-            drawDigit(rightScore % 10, rightX + 25, scoreY, digitSize);
+            drawDigit(state.rightScore / 10, rightX - 25, scoreY, digitSize);
+            drawDigit(state.rightScore % 10, rightX + 25, scoreY, digitSize);
         }
     }
 
-    void onEvent(const sf::Event& event) override {
-        if (const auto* keyPressed = event.getIf<sf::Event::KeyPressed>()) {
-            if (gameState == GameState::MainMenu) {
-                handleMenuInput(keyPressed->code);
-            } else if (gameState == GameState::Playing) {
-                handleGameplayInput(keyPressed->code);
-            } else if (gameState == GameState::Paused) {
-                handlePauseInput(keyPressed->code);
-            } else if (gameState == GameState::ExitConfirmation) {
-                handleExitConfirmation(keyPressed->code);
-            }
+    void handleKeyPressed(sf::Keyboard::Key key) {
+        if (gameState == GameState::MainMenu) {
+            handleMenuInput(key);
+        } else if (gameState == GameState::Playing) {
+            handleGameplayInput(key);
+        } else if (gameState == GameState::Paused) {
+            handlePauseInput(key);
+        } else if (gameState == GameState::ExitConfirmation) {
+            handleExitConfirmation(key);
         }
     }
 
@@ -546,7 +781,7 @@ protected:
         if (key == sf::Keyboard::Key::R) {
             leftScore = 0;
             rightScore = 0;
-            ball->reset(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
+            serveBall();
         } else if (key == sf::Keyboard::Key::Escape) {
             gameState = GameState::Paused;
             selectedPauseOption = 0; // Default to Resume
@@ -566,17 +801,15 @@ protected:
                 // Restart
                 leftScore = 0;
                 rightScore = 0;
-                ball->reset(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
+                serveBall();
                 gameState = GameState::Playing;
             } else if (selectedPauseOption == 2) {
                 // Main Menu
                 gameState = GameState::MainMenu;
                 leftScore = 0;
                 rightScore = 0;
-                if (aiController) {
-                    delete aiController;
-                    aiController = nullptr;
-                }
+                aiController = AIHandle();
+                leftAIController = AIHandle();
             } else if (selectedPauseOption == 3) {
                 // Exit
                 previousState = GameState::Paused;
@@ -594,8 +827,8 @@ protected:
             selectedExitOption = 1 - selectedExitOption; // Toggle between 0 and 1
         } else if (key == sf::Keyboard::Key::Enter) {
             if (selectedExitOption == 0) {
-                // Yes - exit game
-                window->close();
+                // Yes - exit game (stop() is safe from the pipelined update thread)
+                stop();
             } else {
                 // No - go back
                 gameState = previousState;
@@ -606,22 +839,28 @@ protected:
         }
     }
 
+    // Serves from the centre. The ball jumps there, so it is not blended in from where it was.
+    void serveBall() {
+        balls.at(ball).reset(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
+        previousBall = balls.at(ball).getRenderData();
+    }
+
     void startGame() {
         leftScore = 0;
         rightScore = 0;
-        ball->reset(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
+        serveBall();
 
-        if (gameMode == GameMode::VsAI) {
-            if (!aiController) {
-                aiController = new AIController(rightPaddle, aiDifficulty);
-            } else {
-                aiController->setDifficulty(aiDifficulty);
-            }
-        } else {
-            if (aiController) {
-                delete aiController;
-                aiController = nullptr;
-            }
+        aiController = AIHandle();
+        leftAIController = AIHandle();
+
+        if (gameMode == GameMode::VsAI || gameMode == GameMode::AIVsAI) {
+            aiController = rightAI;
+            aiControllers.at(aiController).setDifficulty(aiDifficulty);
+        }
+
+        if (gameMode == GameMode::AIVsAI) {
+            leftAIController = leftAI;
+            aiControllers.at(leftAIController).setDifficulty(aiDifficulty);
         }
 
         gameState = GameState::Playing;
@@ -0,0 +1,203 @@
+#pragma once
+#include "../../Engine/Core/Application.h"
+#include "../../Engine/Core/TimingStats.h"
+#include "Systems/PongSystems.h"
+#include <chrono>
+#include <cstdio>
+#include <ostream>
+
+// Load test: any number of balls bouncing between the walls and two self-driving paddles,
+// simulated with the ECS Pong systems. Every frame is split into phases that are timed
+// separately. The seed and the timestep are fixed, so two instances with the same ball
+// and frame count simulate exactly the same frames.
+class PongStressTest : public Engine::Core::Application {
+public:
+    enum Phase {
+        Events,
+        Update,
+        Collisions,
+        Render,
+        Display,
+        Frame,
+        PHASE_COUNT
+    };
+
+private:
+    Engine::ECS::World world;
+    PongField field;
+    PongScore score;
+    Engine::Math::Random random;
+    std::size_t ballCount;
+    Engine::Core::TimingStats phases[PHASE_COUNT];
+    std::size_t framesRun;
+
+    const float FIELD_WIDTH = 800.0f;
+    const float FIELD_HEIGHT = 600.0f;
+    const float PADDLE_WIDTH = 15.0f;
+    const float PADDLE_HEIGHT = 100.0f;
+    const float PADDLE_SPEED = 400.0f;
+    const float BALL_RADIUS = 4.0f;
+    const float BALL_SPEED = 300.0f;
+    const float TICK_TIME = 1.0f / 120.0f;
+    const std::uint64_t SEED = 12345;
+
+public:
+    PongStressTest(std::size_t ballCount, bool headless = false)
+        : Engine::Core::Application("Pong Stress Test", 800, 600, headless),
+          field{FIELD_WIDTH, FIELD_HEIGHT}, score{0, 0}, random(SEED),
+          ballCount(ballCount > 0 ? ballCount : 1), framesRun(0) {
+        // Measure the engine, not the frame pacer
+        setFramePacing(Engine::Core::FramePacing::Uncapped);
+        spawn();
+    }
+
+    // Runs frameCount frames (fewer if the window is closed) and records every phase.
+    // Headless runs have no events, render or display phases. Calling it again continues
+    // the same simulation with fresh timings.
+    void runBenchmark(std::size_t frameCount) {
+        running = true;
+
+        for (Engine::Core::TimingStats& phase : phases) {
+            phase.clear();
+            phase.reserve(frameCount);
+        }
+
+        using Clock = std::chrono::steady_clock;
+        for (framesRun = 0; framesRun < frameCount && running; framesRun++) {
+            Clock::time_point frameStart = Clock::now();
+            Clock::time_point phaseStart = frameStart;
+
+            if (!headless) {
+                processEvents();
+                phaseStart = record(Events, phaseStart);
+                if (!window->isOpen()) {
+                    break;
+                }
+            }
+
+            simulateMovement(TICK_TIME);
+            phaseStart = record(Update, phaseStart);
+
+            BallSystem::collide(world, field, score, random);
+            phaseStart = record(Collisions, phaseStart);
+
+            if (!headless) {
+                drawScene();
+                renderer->flush();
+                phaseStart = record(Render, phaseStart);
+
+                renderer->display();
+                record(Display, phaseStart);
+            }
+
+            record(Frame, frameStart);
+        }
+    }
+
+    const Engine::Core::TimingStats& getPhaseStats(Phase phase) const {
+        return phases[phase];
+    }
+
+    static const char* getPhaseName(Phase phase) {
+        static const char* names[PHASE_COUNT] = {"events", "update", "collisions", "render", "display", "frame"};
+        return names[phase];
+    }
+
+    void printReport(std::ostream& out) const {
+        out << "mode: " << (headless ? "headless" : "windowed") << "\n"
+            << "balls: " << ballCount << "\n"
+            << "frames: " << framesRun << "\n"
+            << "phase        min_ms    mean_ms   p99_ms\n";
+
+        char line[96];
+        for (int i = 0; i < PHASE_COUNT; i++) {
+            const Engine::Core::TimingStats& stats = phases[i];
+            if (stats.getSampleCount() == 0) {
+                continue;
+            }
+
+            std::snprintf(line, sizeof(line), "%-12s %-9.4f %-9.4f %.4f\n", getPhaseName(static_cast<Phase>(i)),
+                          stats.getMin(), stats.getMean(), stats.getPercentile(99.0));
+            out << line;
+        }
+    }
+
+protected:
+    void update(float deltaTime) override {
+        simulateMovement(deltaTime);
+        BallSystem::collide(world, field, score, random);
+    }
+
+    void render() override {
+        drawScene();
+        renderer->display();
+    }
+
+private:
+    void spawn() {
+        using namespace Engine::ECS;
+
+        float paddleY = FIELD_HEIGHT / 2 - PADDLE_HEIGHT / 2;
+        PaddleBody paddle{PADDLE_WIDTH, PADDLE_HEIGHT, PADDLE_SPEED, 0.0f, FIELD_HEIGHT};
+        world.create(Position{30.0f, paddleY}, paddle, PaddleInput{1.0f});
+        world.create(Position{FIELD_WIDTH - 30.0f - PADDLE_WIDTH, paddleY}, paddle, PaddleInput{-1.0f});
+
+        // Spread the balls over the field between the paddles
+        for (std::size_t i = 0; i < ballCount; i++) {
+            Position position{};
+            Velocity velocity{};
+            BallBody body{BALL_RADIUS, BALL_SPEED, BALL_SPEED};
+            float x = random.range(100.0f, FIELD_WIDTH - 100.0f);
+            float y = random.range(BALL_RADIUS, FIELD_HEIGHT - BALL_RADIUS);
+            BallSystem::reset(position, velocity, body, x, y, random);
+            world.create(position, velocity, body);
+        }
+    }
+
+    std::chrono::steady_clock::time_point record(Phase phase, std::chrono::steady_clock::time_point start) {
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        phases[phase].addSample(std::chrono::duration<double, std::milli>(now - start).count());
+        return now;
+    }
+
+    // Paddles sweep up and down the field, turning around at the walls
+    void steerPaddles() {
+        using namespace Engine::ECS;
+        world.each<Position, PaddleBody, PaddleInput>([](std::size_t count, const EntityId*, Position* positions,
+                                                         PaddleBody* bodies, PaddleInput* inputs) {
+            for (std::size_t i = 0; i < count; i++) {
+                if (positions[i].y <= bodies[i].minY) {
+                    inputs[i].direction = 1.0f;
+                } else if (positions[i].y + bodies[i].height >= bodies[i].maxY) {
+                    inputs[i].direction = -1.0f;
+                }
+            }
+        });
+    }
+
+    void simulateMovement(float deltaTime) {
+        steerPaddles();
+        PaddleSystem::update(world, deltaTime);
+        Engine::ECS::MovementSystem::update(world, deltaTime);
+    }
+
+    void drawScene() {
+        using namespace Engine::ECS;
+        window->clear(sf::Color::Black);
+
+        world.each<Position, PaddleBody>([this](std::size_t count, const EntityId*, Position* positions,
+                                                PaddleBody* bodies) {
+            for (std::size_t i = 0; i < count; i++) {
+                renderer->drawRectangle({positions[i].x, positions[i].y}, {bodies[i].width, bodies[i].height},
+                                        sf::Color::White);
+            }
+        });
+
+        world.each<Position, BallBody>([this](std::size_t count, const EntityId*, Position* positions,
+                                              BallBody* bodies) {
+            for (std::size_t i = 0; i < count; i++) {
+                renderer->drawCircle({positions[i].x, positions[i].y}, bodies[i].radius, sf::Color::White);
+            }
+        });
+    }
+};
@@ -0,0 +1,136 @@
+#pragma once
+#include "../../../Engine/ECS/Systems.h"
+#include "../../../Engine/Math/Random.h"
+#include <cmath>
+
+// Pong behaviour expressed as components and systems on Engine::ECS::World.
+// Follows the same rules as Paddle, Ball and PongGame::moveBall, but runs over dense
+// per-archetype arrays so any number of paddles and balls can share one world. Collision
+// here is a discrete overlap test after integration, not swept.
+
+struct PaddleBody {
+    float width;
+    float height;
+    float speed;
+    float minY;
+    float maxY;
+};
+
+// -1 moves up, +1 moves down, 0 holds still
+struct PaddleInput {
+    float direction;
+};
+
+struct BallBody {
+    float radius;
+    float initialSpeed;
+    float currentSpeed;
+};
+
+struct PongField {
+    float width;
+    float height;
+};
+
+struct PongScore {
+    int left;
+    int right;
+};
+
+class PaddleSystem {
+public:
+    static void update(Engine::ECS::World& world, float deltaTime) {
+        using namespace Engine::ECS;
+        world.each<Position, PaddleBody, PaddleInput>([deltaTime](std::size_t count, const EntityId*,
+                                                                  Position* positions, PaddleBody* bodies,
+                                                                  PaddleInput* inputs) {
+            for (std::size_t i = 0; i < count; i++) {
+                float y = positions[i].y + inputs[i].direction * bodies[i].speed * deltaTime;
+                if (y < bodies[i].minY) {
+                    y = bodies[i].minY;
+                }
+                if (y + bodies[i].height > bodies[i].maxY) {
+                    y = bodies[i].maxY - bodies[i].height;
+                }
+                positions[i].y = y;
+            }
+        });
+    }
+};
+
+class BallSystem {
+public:
+    static void reset(Engine::ECS::Position& position, Engine::ECS::Velocity& velocity,
+                      BallBody& body, float x, float y, Engine::Math::Random& random) {
+        position.x = x;
+        position.y = y;
+        body.currentSpeed = body.initialSpeed;
+
+        float angle = random.range(-30, 29) * 3.14159f / 180.0f;
+        float direction = random.nextBool() ? 1.0f : -1.0f;
+
+        velocity.x = direction * body.currentSpeed * cos(angle);
+        velocity.y = body.currentSpeed * sin(angle);
+    }
+
+    static void handlePaddleCollision(const Engine::ECS::Position& position, Engine::ECS::Velocity& velocity,
+                                      BallBody& body, float paddleCenterY) {
+        float relativeIntersectY = paddleCenterY - position.y;
+        float normalizedIntersect = relativeIntersectY / 50.0f;
+        float bounceAngle = normalizedIntersect * (60.0f * 3.14159f / 180.0f);
+
+        float direction = (velocity.x > 0) ? -1.0f : 1.0f;
+        velocity.x = direction * body.currentSpeed * cos(bounceAngle);
+        velocity.y = -body.currentSpeed * sin(bounceAngle);
+
+        body.currentSpeed *= 1.05f;
+    }
+
+    // Walls, paddles and goals for every ball against every paddle; random serves the scored balls
+    static void collide(Engine::ECS::World& world, const PongField& field, PongScore& score,
+                        Engine::Math::Random& random) {
+        using namespace Engine::ECS;
+        world.each<Position, Velocity, BallBody>([&](std::size_t ballCount, const EntityId*,
+                                                     Position* ballPositions, Velocity* ballVelocities,
+                                                     BallBody* balls) {
+            for (std::size_t b = 0; b < ballCount; b++) {
+                Position& position = ballPositions[b];
+                Velocity& velocity = ballVelocities[b];
+                BallBody& ball = balls[b];
+
+                if (position.y - ball.radius <= 0 || position.y + ball.radius >= field.height) {
+                    velocity.y = -velocity.y;
+                }
+
+                world.each<Position, PaddleBody>([&](std::size_t paddleCount, const EntityId*,
+                                                     Position* paddlePositions, PaddleBody* paddles) {
+                    for (std::size_t p = 0; p < paddleCount; p++) {
+                        // Strict overlap, same as sf::FloatRect::findIntersection
+                        bool overlapX = position.x - ball.radius < paddlePositions[p].x + paddles[p].width &&
+                                        paddlePositions[p].x < position.x + ball.radius;
+                        bool overlapY = position.y - ball.radius < paddlePositions[p].y + paddles[p].height &&
+                                        paddlePositions[p].y < position.y + ball.radius;
+                        if (overlapX && overlapY) {
+                            handlePaddleCollision(position, velocity, ball,
+                                                  paddlePositions[p].y + paddles[p].height / 2.0f);
+                        }
+                    }
+                });
+
+                if (position.x - ball.radius <= 0) {
+                    score.right++;
+                    reset(position, velocity, ball, field.width / 2, field.height / 2, random);
+                } else if (position.x + ball.radius >= field.width) {
+                    score.left++;
+                    reset(position, velocity, ball, field.width / 2, field.height / 2, random);
+                }
+            }
+        });
+    }
+
+    static void update(Engine::ECS::World& world, float deltaTime, const PongField& field, PongScore& score,
+                       Engine::Math::Random& random) {
+        Engine::ECS::MovementSystem::update(world, deltaTime);
+        collide(world, field, score, random);
+    }
+};
@@ -1,7 +1,174 @@
+// Count heap allocations (see Engine/Core/AllocationTracker.h); must precede the engine headers
+#define ENGINE_TRACK_ALLOCATIONS
 #include "PongGame.h"
+#include "PongStressTest.h"
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
 
-int main() {
-    PongGame game;
+// A positive decimal count (ticks, runs, ...); false for zero, a sign or trailing text
+static bool parseCount(const char* text, std::uint64_t& count) {
+    char* end = nullptr;
+    count = std::strtoull(text, &end, 10);
+    return text[0] != '-' && end != text && *end == '\0' && count > 0;
+}
+
+int main(int argc, char* argv[]) {
+    // pong --headless [ticks]: simulate an AI vs AI match without a window and report throughput
+    if (argc > 1 && std::string(argv[1]) == "--headless") {
+        std::uint64_t ticks = 1000000;
+        // runHeadless(0) runs until the game stops itself, which an AI match never does
+        if (argc > 2 && !parseCount(argv[2], ticks)) {
+            std::cerr << "--headless needs a positive tick count, got: " << argv[2] << "\n";
+            return 1;
+        }
+
+        PongGame game(true);
+        Engine::Core::HeadlessStats stats = game.runHeadless(ticks);
+
+        std::cout << "ticks: " << stats.ticks << "\n"
+                  << "seconds: " << stats.seconds << "\n"
+                  << "ticks_per_second: " << stats.ticksPerSecond << "\n";
+        return 0;
+    }
+
+    // pong --stress [balls] [frames] [--headless]: time every frame phase with many balls in play
+    // (1000 of each by default); --headless may come anywhere
+    if (argc > 1 && std::string(argv[1]) == "--stress") {
+        std::uint64_t counts[2] = {1000, 1000}; // Balls, frames
+        const char* countNames[2] = {"ball", "frame"};
+        std::size_t countsGiven = 0;
+        bool headless = false;
+        for (int i = 2; i < argc; i++) {
+            std::string arg = argv[i];
+            if (arg == "--headless") {
+                headless = true;
+            } else if (countsGiven == 2) {
+                std::cerr << "--stress: unexpected argument: " << arg << "\n";
+                return 1;
+            } else if (!parseCount(argv[i], counts[countsGiven])) {
+                std::cerr << "--stress needs a positive " << countNames[countsGiven] << " count, got: " << arg << "\n";
+                return 1;
+            } else {
+                countsGiven++;
+            }
+        }
+        std::size_t balls = static_cast<std::size_t>(counts[0]);
+        std::size_t frames = static_cast<std::size_t>(counts[1]);
+
+        PongStressTest stress(balls, headless);
+        stress.runBenchmark(frames);
+        stress.printReport(std::cout);
+        return 0;
+    }
+
+    // pong --replay <file> [runs]: replay a --record session headless at full speed, e.g. as
+    // a repeatable benchmark workload
+    if (argc > 2 && std::string(argv[1]) == "--replay") {
+        std::uint64_t runs = 1;
+        if (argc > 3 && !parseCount(argv[3], runs)) {
+            std::cerr << "--replay needs a positive run count, got: " << argv[3] << "\n";
+            return 1;
+        }
+        std::ifstream file(argv[2], std::ios::binary);
+
+        for (std::uint64_t run = 0; run < runs; run++) {
+            file.clear();
+            file.seekg(0);
+            Engine::Input::InputPlayer player(file);
+            if (!player.isValid()) {
+                std::cerr << "not an input recording: " << argv[2] << "\n";
+                return 1;
+            }
+
+            PongGame game(true, player.getSeed(), true);
+            game.setInputPlayer(&player);
+            Engine::Core::HeadlessStats stats = game.runHeadless();
+
+            std::cout << "run " << run << ": ticks " << stats.ticks << ", seconds " << stats.seconds
+                      << ", ticks_per_second " << stats.ticksPerSecond
+                      << ", score " << game.getLeftScore() << "-" << game.getRightScore() << "\n";
+        }
+        return 0;
+    }
+
+    // pong --seed <n>: replay the serves and AI behaviour of an earlier game (default: time-based)
+    std::uint64_t seed = static_cast<std::uint64_t>(std::time(nullptr));
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::string(argv[i]) == "--seed") {
+            seed = std::strtoull(argv[i + 1], nullptr, 10);
+        }
+    }
+    // Printed so that any game, not just a recorded one, can be repeated with --seed
+    std::cout << "seed: " << seed << "\n";
+
+    PongGame game(false, seed);
+    std::string tracePath;
+    std::ofstream recordFile;
+    std::unique_ptr<Engine::Input::InputRecorder> recorder;
+    bool frameStats = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        // pong --pipelined: simulate the next frame on a worker thread while this one is drawn
+        if (arg == "--pipelined") {
+            game.setPipelined(true);
+        }
+        // pong --trace <file>: write a Chrome/Perfetto trace of the last frames on exit
+        if (arg == "--trace" && i + 1 < argc) {
+            tracePath = argv[++i];
+        }
+        // pong --alloc-check: report every gameplay frame that allocates on the heap
+        if (arg == "--alloc-check") {
+            game.setFrameAllocationBudget(0);
+        }
+        // pong --record <file>: save the seed and every tick's input for --replay
+        if (arg == "--record" && i + 1 < argc) {
+            recordFile.open(argv[++i], std::ios::binary);
+            recorder = std::make_unique<Engine::Input::InputRecorder>(recordFile, seed,
+                                                                      1.0f / PongGame::TICKS_PER_SECOND);
+            game.setInputRecorder(recorder.get());
+        }
+        // pong --pacing <uncapped|vsync|fps>: how frames are paced (default: 60 fps)
+        if (arg == "--pacing" && i + 1 < argc) {
+            std::string pacing = argv[++i];
+            if (pacing == "uncapped") {
+                game.setFramePacing(Engine::Core::FramePacing::Uncapped);
+            } else if (pacing == "vsync") {
+                game.setFramePacing(Engine::Core::FramePacing::VSync);
+            } else {
+                game.setFramePacing(Engine::Core::FramePacing::TargetRate, std::atof(pacing.c_str()));
+            }
+        }
+        // pong --frame-stats: print frame-time percentiles on exit
+        if (arg == "--frame-stats") {
+            frameStats = true;
+        }
+    }
     game.run();
+
+    if (frameStats) {
+        const Engine::Core::FramePacer& pacer = game.getFramePacer();
+        const Engine::Core::FrameTimeHistogram& frames = pacer.getFrameTimes();
+        const Engine::Core::FrameTimeHistogram& work = pacer.getWorkTimes();
+        std::cout << "frames: " << frames.getCount() << ", missed deadlines: " << pacer.getMissedDeadlines() << "\n"
+                  << "frame ms: p50 " << frames.getPercentile(50) << ", p99 " << frames.getPercentile(99)
+                  << ", max " << frames.getMax() << "\n"
+                  << "work ms:  p50 " << work.getPercentile(50) << ", p99 " << work.getPercentile(99)
+                  << ", max " << work.getMax() << "\n";
+    }
+
+    if (recorder) {
+        recorder->finish();
+        std::cout << "recorded " << recorder->getTickCount() << " ticks, "
+                  << recorder->getBytesWritten() << " bytes\n";
+    }
+
+    if (!tracePath.empty()) {
+        std::ofstream trace(tracePath);
+        Engine::Core::Profiler::writeChromeTrace(trace);
+    }
     return 0;
 }
@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdio>
+
+// Minimal test harness: CHECK records a failure and carries on, so one run reports
+// every mismatch; main returns Test::finish() as the process exit code
+namespace Test {
+    inline int& failureCount() {
+        static int count = 0;
+        return count;
+    }
+
+    inline int& checkCount() {
+        static int count = 0;
+        return count;
+    }
+
+    inline bool check(bool passed, const char* expression, const char* file, int line) {
+        checkCount()++;
+        if (!passed) {
+            failureCount()++;
+            std::printf("%s:%d: check failed: %s\n", file, line, expression);
+        }
+        return passed;
+    }
+
+    inline int finish(const char* suite) {
+        std::printf("%s: %d checks, %d failed\n", suite, checkCount(), failureCount());
+        return failureCount() == 0 ? 0 : 1;
+    }
+}
+
+#define CHECK(expression) ::Test::check((expression), #expression, __FILE__, __LINE__)
@@ -0,0 +1,165 @@
+// A PongBatchEnv match must move like PongGame: a scripted two-player session is played
+// in the real game, and every tick the batch env is stepped from the game's ball with the
+// same paddle inputs and has to land where PongGame::moveBall put the ball. The ball is
+// taken over from the game each tick because the two compute contacts with different
+// rounding, and a paddle bounce amplifies any difference in where the ball met it.
+// Skipped are the contacts the batch env does not model: the ball meeting a paddle's rounded
+// corner, or being bounced off its top or bottom after passing the face.
+#include "Check.h"
+#include "PongBatchEnv.h"
+#include "PongGame.h"
+#include "Input/InputRecording.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    using Key = sf::Keyboard::Key;
+
+    const std::uint64_t SEED = 20;
+    const std::uint64_t TICKS = 60000;
+    const std::uint64_t START_TICK = 2; // Enter on tick 1 starts "PLAY WITH FRIEND"
+
+    // The session's snapshots, and the recording PongGame replays them from
+    struct Session {
+        std::string recording;
+        std::vector<Engine::Input::InputSnapshot> snapshots;
+    };
+
+    // Each paddle alternates between holding still, moving up and moving down, on
+    // different periods, so the ball meets paddles at rest and in motion and also misses
+    Session scriptSession() {
+        Session session;
+        std::ostringstream out;
+        Engine::Input::InputRecorder recorder(out, SEED, 1.0f / PongGame::TICKS_PER_SECOND);
+        Engine::Input::InputSystem input;
+
+        auto send = [&input](Key key, bool down) {
+            if (down) {
+                input.handleEvent(sf::Event(sf::Event::KeyPressed{key, false, false, false, false}));
+            } else {
+                input.handleEvent(sf::Event(sf::Event::KeyReleased{key, false, false, false, false}));
+            }
+        };
+
+        for (std::uint64_t tick = 0; tick < TICKS; tick++) {
+            if (tick == 1 || tick == 2) {
+                send(Key::Enter, tick == 1);
+            } else if (tick >= START_TICK) {
+                std::uint64_t leftPhase = (tick / 50) % 3;
+                std::uint64_t rightPhase = (tick / 70) % 3;
+                send(Key::W, leftPhase == 1);
+                send(Key::S, leftPhase == 2);
+                send(Key::Up, rightPhase == 2);
+                send(Key::Down, rightPhase == 1);
+            }
+            input.beginTick();
+            recorder.record(input.getSnapshot());
+            session.snapshots.push_back(input.getSnapshot());
+        }
+        recorder.finish();
+        session.recording = out.str();
+        return session;
+    }
+
+    std::int8_t paddleAction(const Engine::Input::InputSnapshot& snapshot, Key up, Key down) {
+        return static_cast<std::int8_t>((snapshot.isKeyDown(down) ? 1 : 0) - (snapshot.isKeyDown(up) ? 1 : 0));
+    }
+
+    bool near(float expected, float actual, float tolerance) {
+        return std::fabs(expected - actual) <= tolerance * std::max(1.0f, std::fabs(expected));
+    }
+}
+
+int main() {
+    Session session = scriptSession();
+    std::istringstream in(session.recording);
+    Engine::Input::InputPlayer player(in);
+    PongGame game(true, player.getSeed(), true);
+    game.setInputPlayer(&player);
+    game.runHeadless(START_TICK);
+
+    PongBatchConfig config;
+    config.tickTime = 1.0f / PongGame::TICKS_PER_SECOND;
+    config.pointsToWin = 1 << 30;
+    PongBatchEnv env(1, config);
+
+    std::int8_t actions[PongBatchEnv::ACTIONS_PER_MATCH];
+    float observation[PongBatchEnv::OBSERVATION_SIZE];
+    float reward;
+    std::uint8_t done;
+
+    const float leftFace = config.paddleInset + config.paddleWidth + config.ballRadius;
+    const float rightFace = config.fieldWidth - config.paddleInset - config.paddleWidth - config.ballRadius;
+    auto behindFace = [leftFace, rightFace](float x) {
+        return x < leftFace || x > rightFace;
+    };
+
+    int paddleHits = 0;
+    int goals = 0;
+    int skipped = 0;
+    int mismatches = 0;
+    for (std::uint64_t tick = START_TICK; tick < TICKS; tick++) {
+        const Ball& ball = game.getBall();
+        env.setBall(0, ball.getPosition().x, ball.getPosition().y, ball.getVelocity().x, ball.getVelocity().y,
+                    ball.getSpeed());
+        float speedBefore = ball.getSpeed();
+        bool startedBehind = behindFace(ball.getPosition().x);
+        sf::Vector2f start(ball.getPosition().x, ball.getPosition().y);
+        sf::Vector2f velocity(ball.getVelocity().x, ball.getVelocity().y);
+        int scoreBefore = game.getLeftScore() - game.getRightScore();
+
+        const Engine::Input::InputSnapshot& snapshot = session.snapshots[tick];
+        actions[0] = paddleAction(snapshot, Key::W, Key::S);
+        actions[1] = paddleAction(snapshot, Key::Up, Key::Down);
+        env.step(actions, observation, &reward, &done);
+        game.runHeadless(1);
+
+        // A goal: both sides score it on the same tick, then serve from their own random
+        // streams, so the new ball is not compared
+        int scored = game.getLeftScore() - game.getRightScore() - scoreBefore;
+        if (!CHECK(static_cast<float>(scored) == reward)) {
+            std::printf("  tick %llu: game scored %d, env reward %g\n",
+                        static_cast<unsigned long long>(tick), scored, reward);
+        }
+        if (scored != 0) {
+            goals++;
+            continue;
+        }
+        // Where the ball crossed the face, if either side bounced it off a paddle
+        bool bounced = ball.getSpeed() != speedBefore || (observation[2] < 0.0f) != (velocity.x < 0.0f);
+        const Paddle& paddle = velocity.x < 0.0f ? game.getLeftPaddle() : game.getRightPaddle();
+        float face = velocity.x < 0.0f ? leftFace : rightFace;
+        float contactY = start.y + velocity.y * (face - start.x) / velocity.x;
+        float paddleTop = paddle.getCenterY() - config.paddleHeight / 2.0f;
+        bool corner = bounced && (contactY < paddleTop || contactY > paddleTop + config.paddleHeight);
+
+        if (startedBehind || behindFace(ball.getPosition().x) || corner) {
+            skipped++;
+            continue;
+        }
+        paddleHits += bounced ? 1 : 0;
+
+        const float expected[PongBatchEnv::OBSERVATION_SIZE] = {
+            ball.getPosition().x, ball.getPosition().y, ball.getVelocity().x, ball.getVelocity().y,
+            game.getLeftPaddle().getCenterY(), game.getRightPaddle().getCenterY()
+        };
+        for (std::size_t i = 0; i < PongBatchEnv::OBSERVATION_SIZE; i++) {
+            if (!CHECK(near(expected[i], observation[i], 1e-4f)) && ++mismatches <= 10) {
+                std::printf("  tick %llu, observation %zu: game %.6f, env %.6f\n",
+                            static_cast<unsigned long long>(tick), i, expected[i], observation[i]);
+            }
+        }
+    }
+
+    // The script has to exercise both paddles and both goals for the comparison to mean much
+    CHECK(paddleHits >= 20);
+    CHECK(goals >= 10);
+    std::printf("pong_batch_parity: %d paddle hits, %d goals, %d ticks at a corner or behind a paddle skipped\n",
+                paddleHits, goals, skipped);
+
+    return Test::finish("pong_batch_parity");
+}
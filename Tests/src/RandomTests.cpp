@@ -0,0 +1,147 @@
+// Random: determinism, stream() giving distinct generators that do not depend on how far
+// the parent has advanced, unbiased bounded integers, advance() and split()
+#include "Check.h"
+#include "Math/Random.h"
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+
+using Engine::Math::Random;
+
+namespace {
+    // The first four outputs, to tell generators apart
+    std::uint64_t fingerprint(Random random) {
+        std::uint64_t value = 0;
+        for (int i = 0; i < 4; i++) {
+            value = value * 31 + random.next();
+        }
+        return value;
+    }
+}
+
+int main() {
+    Random a(42);
+    Random b(42);
+    for (int i = 0; i < 100; i++) {
+        CHECK(a.next() == b.next());
+    }
+
+    Random fresh(42);
+    Random used(42);
+    for (int i = 0; i < 17; i++) {
+        used.next();
+    }
+    for (std::uint64_t index = 0; index < 8; index++) {
+        Random first = fresh.stream(index);
+        Random second = used.stream(index);
+        CHECK(first.next() == second.next());
+    }
+
+    // Every stream of a family starts differently
+    Random parent(7);
+    for (std::uint64_t i = 0; i < 8; i++) {
+        for (std::uint64_t j = i + 1; j < 8; j++) {
+            Random left = parent.stream(i);
+            Random right = parent.stream(j);
+            CHECK(left.next() != right.next());
+        }
+    }
+
+    // Stream 0 is the generator itself as constructed
+    Random original(7);
+    Random zero = parent.stream(0);
+    CHECK(zero.next() == original.next());
+
+    // range(-30, 29), as Ball::reset draws its serve angle: every value, bounds included,
+    // comes up about equally often and nothing falls outside
+    {
+        Random random(3);
+        const int DRAWS = 120000;
+        int counts[60] = {};
+        bool inside = true;
+        for (int i = 0; i < DRAWS; i++) {
+            int value = random.range(-30, 29);
+            if (value < -30 || value > 29) {
+                inside = false;
+            } else {
+                counts[value + 30]++;
+            }
+        }
+        CHECK(inside);
+        for (int i = 0; i < 60; i++) {
+            // Expected 2000 each; 10% is over four standard deviations
+            if (!CHECK(counts[i] > 1800 && counts[i] < 2200)) {
+                std::printf("  range(-30, 29): %d drawn %d times\n", i - 30, counts[i]);
+            }
+        }
+    }
+
+    // Degenerate and extreme bounds
+    {
+        Random random(4);
+        for (int i = 0; i < 100; i++) {
+            CHECK(random.nextBelow(1) == 0);
+            CHECK(random.range(5, 5) == 5);
+            CHECK(random.range(-1, 0) >= -1 && random.range(-1, 0) <= 0);
+            random.range(INT_MIN, INT_MAX); // The full range: any value is valid
+        }
+    }
+
+    // With bound 3 * 2^30 an unbiased nextBelow puts a third of its draws below 2^30 and a
+    // third on multiples of 3. Reducing next() modulo the bound would put half below 2^30;
+    // the multiply-shift without its rejection step would put half on multiples of 3.
+    {
+        Random random(5);
+        const std::uint32_t bound = 3u << 30;
+        const int DRAWS = 30000;
+        int low = 0;
+        int multiplesOf3 = 0;
+        bool below = true;
+        for (int i = 0; i < DRAWS; i++) {
+            std::uint32_t value = random.nextBelow(bound);
+            below = below && value < bound;
+            low += value < (1u << 30) ? 1 : 0;
+            multiplesOf3 += value % 3 == 0 ? 1 : 0;
+        }
+        CHECK(below);
+        if (!CHECK(low > DRAWS * 0.31 && low < DRAWS * 0.36)) {
+            std::printf("  nextBelow(3 * 2^30): %d of %d draws below 2^30\n", low, DRAWS);
+        }
+        if (!CHECK(multiplesOf3 > DRAWS * 0.31 && multiplesOf3 < DRAWS * 0.36)) {
+            std::printf("  nextBelow(3 * 2^30): %d of %d draws are multiples of 3\n", multiplesOf3, DRAWS);
+        }
+    }
+
+    // advance(n) lands where n calls to next() do, on any stream
+    {
+        const std::uint64_t deltas[] = {0, 1, 2, 7, 64, 1000, 12345};
+        for (std::uint64_t delta : deltas) {
+            Random stepped(9, 3);
+            Random skipped(9, 3);
+            for (std::uint64_t i = 0; i < delta; i++) {
+                stepped.next();
+            }
+            skipped.advance(delta);
+            if (!CHECK(fingerprint(stepped) == fingerprint(skipped))) {
+                std::printf("  advance(%llu) differs from stepping\n", static_cast<unsigned long long>(delta));
+            }
+        }
+    }
+
+    // split(): children differ from the parent and from each other, and the same parent
+    // always splits off the same children
+    {
+        Random parent(11);
+        Random twin(11);
+        Random children[4] = {parent.split(), parent.split(), parent.split(), parent.split()};
+        for (int i = 0; i < 4; i++) {
+            CHECK(fingerprint(children[i]) != fingerprint(parent));
+            CHECK(fingerprint(children[i]) == fingerprint(twin.split()));
+            for (int j = i + 1; j < 4; j++) {
+                CHECK(fingerprint(children[i]) != fingerprint(children[j]));
+            }
+        }
+    }
+
+    return Test::finish("random");
+}
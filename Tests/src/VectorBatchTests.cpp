@@ -0,0 +1,196 @@
+// Every VectorBatch kernel, at every SIMD level the CPU supports, must give bit-for-bit
+// the results of the scalar Vector2 operators, including in the scalar tail loops and
+// for NaN, infinity, signed zero and subnormal inputs.
+#include "Check.h"
+#include "Math/Random.h"
+#include "Math/Vector2.h"
+#include "Math/VectorBatch.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using Engine::Math::Random;
+using Engine::Math::SimdLevel;
+using Engine::Math::Vector2;
+using Engine::Math::VectorBatch;
+
+namespace {
+    const char* levelName(SimdLevel level) {
+        switch (level) {
+            case SimdLevel::Scalar: return "scalar";
+            case SimdLevel::SSE2: return "sse2";
+            case SimdLevel::AVX2: return "avx2";
+        }
+        return "?";
+    }
+
+    // Same bits, or both NaN (the payload may differ)
+    bool same(float expected, float actual) {
+        if (std::isnan(expected) || std::isnan(actual)) {
+            return std::isnan(expected) && std::isnan(actual);
+        }
+        std::uint32_t a;
+        std::uint32_t b;
+        std::memcpy(&a, &expected, sizeof(a));
+        std::memcpy(&b, &actual, sizeof(b));
+        return a == b;
+    }
+
+    void expectSame(const char* kernel, SimdLevel level, std::size_t count, std::size_t index,
+                    float expected, float actual) {
+        if (!CHECK(same(expected, actual))) {
+            std::printf("  %s [%s] count %zu, element %zu: expected %.9g, got %.9g\n",
+                        kernel, levelName(level), count, index, expected, actual);
+        }
+    }
+
+    // Random values with the special cases mixed in at fixed positions, so every
+    // register lane and the tail loop see them for some count
+    std::vector<float> makeValues(Random& random, std::size_t count) {
+        const float specials[] = {
+            std::numeric_limits<float>::quiet_NaN(),
+            std::numeric_limits<float>::infinity(),
+            -std::numeric_limits<float>::infinity(),
+            0.0f,
+            -0.0f,
+            std::numeric_limits<float>::denorm_min(),
+            std::numeric_limits<float>::max(),
+            -1.0e30f
+        };
+        const std::size_t specialCount = sizeof(specials) / sizeof(specials[0]);
+
+        std::vector<float> values(count);
+        for (std::size_t i = 0; i < count; i++) {
+            values[i] = random.range(-1000.0f, 1000.0f);
+            if (i % 5 == 3) {
+                values[i] = specials[(i / 5) % specialCount];
+            }
+        }
+        return values;
+    }
+
+    void testLevel(SimdLevel level, std::size_t count, Random& random) {
+        const float deltaTime = 1.0f / 120.0f;
+        const float scalar = -2.5f;
+
+        std::vector<float> xs = makeValues(random, count);
+        std::vector<float> ys = makeValues(random, count);
+        std::vector<float> vxs = makeValues(random, count);
+        std::vector<float> vys = makeValues(random, count);
+
+        // integrate: p + v * dt
+        {
+            std::vector<float> outX = xs;
+            std::vector<float> outY = ys;
+            VectorBatch::integrate(outX.data(), outY.data(), vxs.data(), vys.data(), count, deltaTime);
+            for (std::size_t i = 0; i < count; i++) {
+                Vector2 expected = Vector2(xs[i], ys[i]) + Vector2(vxs[i], vys[i]) * deltaTime;
+                expectSame("integrate.x", level, count, i, expected.x, outX[i]);
+                expectSame("integrate.y", level, count, i, expected.y, outY[i]);
+            }
+        }
+
+        // integrateInterleaved: the same on x,y pairs
+        {
+            std::vector<float> positions(count * 2);
+            std::vector<float> velocities(count * 2);
+            for (std::size_t i = 0; i < count; i++) {
+                positions[2 * i] = xs[i];
+                positions[2 * i + 1] = ys[i];
+                velocities[2 * i] = vxs[i];
+                velocities[2 * i + 1] = vys[i];
+            }
+            VectorBatch::integrateInterleaved(positions.data(), velocities.data(), count, deltaTime);
+            for (std::size_t i = 0; i < count; i++) {
+                Vector2 expected = Vector2(xs[i], ys[i]) + Vector2(vxs[i], vys[i]) * deltaTime;
+                expectSame("integrateInterleaved.x", level, count, i, expected.x, positions[2 * i]);
+                expectSame("integrateInterleaved.y", level, count, i, expected.y, positions[2 * i + 1]);
+            }
+        }
+
+        // scale: v * s
+        {
+            std::vector<float> outX = xs;
+            std::vector<float> outY = ys;
+            VectorBatch::scale(outX.data(), outY.data(), count, scalar);
+            for (std::size_t i = 0; i < count; i++) {
+                Vector2 expected = Vector2(xs[i], ys[i]) * scalar;
+                expectSame("scale.x", level, count, i, expected.x, outX[i]);
+                expectSame("scale.y", level, count, i, expected.y, outY[i]);
+            }
+
+            std::vector<float> pairs(count * 2);
+            for (std::size_t i = 0; i < count; i++) {
+                pairs[2 * i] = xs[i];
+                pairs[2 * i + 1] = ys[i];
+            }
+            VectorBatch::scaleInterleaved(pairs.data(), count, scalar);
+            for (std::size_t i = 0; i < count; i++) {
+                Vector2 expected = Vector2(xs[i], ys[i]) * scalar;
+                expectSame("scaleInterleaved.x", level, count, i, expected.x, pairs[2 * i]);
+                expectSame("scaleInterleaved.y", level, count, i, expected.y, pairs[2 * i + 1]);
+            }
+        }
+
+        // length: magnitude()
+        {
+            std::vector<float> out(count);
+            VectorBatch::length(xs.data(), ys.data(), out.data(), count);
+            for (std::size_t i = 0; i < count; i++) {
+                expectSame("length", level, count, i, Vector2(xs[i], ys[i]).magnitude(), out[i]);
+            }
+        }
+
+        // normalize: normalized()
+        {
+            std::vector<float> outX = xs;
+            std::vector<float> outY = ys;
+            VectorBatch::normalize(outX.data(), outY.data(), count);
+            for (std::size_t i = 0; i < count; i++) {
+                Vector2 expected = Vector2(xs[i], ys[i]).normalized();
+                expectSame("normalize.x", level, count, i, expected.x, outX[i]);
+                expectSame("normalize.y", level, count, i, expected.y, outY[i]);
+            }
+        }
+
+        // clampToBounds: std::min(std::max(v, min), max) per component (Vector2 has no clamp)
+        {
+            const float minX = -100.0f;
+            const float minY = -50.0f;
+            const float maxX = 100.0f;
+            const float maxY = 50.0f;
+            std::vector<float> outX = xs;
+            std::vector<float> outY = ys;
+            VectorBatch::clampToBounds(outX.data(), outY.data(), count, minX, minY, maxX, maxY);
+            for (std::size_t i = 0; i < count; i++) {
+                expectSame("clampToBounds.x", level, count, i, std::min(std::max(xs[i], minX), maxX), outX[i]);
+                expectSame("clampToBounds.y", level, count, i, std::min(std::max(ys[i], minY), maxY), outY[i]);
+            }
+        }
+    }
+}
+
+int main() {
+    // Odd counts and counts around the 4- and 8-wide register sizes exercise the tail loops
+    const std::size_t counts[] = {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 101, 1000};
+    const SimdLevel levels[] = {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2};
+    const SimdLevel supported = VectorBatch::detectSimdLevel();
+
+    for (SimdLevel level : levels) {
+        if (level > supported) {
+            std::printf("%s: not supported by this CPU, skipped\n", levelName(level));
+            continue;
+        }
+        VectorBatch::setSimdLevel(level);
+        Random random(6);
+        for (std::size_t count : counts) {
+            testLevel(level, count, random);
+        }
+    }
+    VectorBatch::setSimdLevel(supported);
+
+    return Test::finish("vector_batch");
+}